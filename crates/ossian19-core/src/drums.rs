@@ -0,0 +1,636 @@
+// TR-style drum synthesis engine (native port of web/src/audio/drum-synth.ts)
+// All synthesis-based, no samples. Five classic kits, eleven sounds.
+//
+// Built for throughput: every triggered hit lives in one fixed voice pool and
+// the whole pool renders in a single pass over the output buffer, so a full
+// 16th-note of hits costs one buffer traversal regardless of voice count.
+
+use crate::filter::{FilterType, StateVariableFilter};
+use crate::tables;
+use crate::voice::NoiseGen;
+
+/// Fixed voice pool size; enough for a dense step plus ringing tails
+pub const MAX_DRUM_VOICES: usize = 16;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(u8)]
+pub enum DrumSound {
+    Kick = 0,
+    Snare,
+    Clap,
+    HihatClosed,
+    HihatOpen,
+    TomLow,
+    TomMid,
+    TomHi,
+    Rimshot,
+    Cowbell,
+    Cymbal,
+}
+
+impl DrumSound {
+    pub fn from_u8(value: u8) -> Option<Self> {
+        match value {
+            0 => Some(Self::Kick),
+            1 => Some(Self::Snare),
+            2 => Some(Self::Clap),
+            3 => Some(Self::HihatClosed),
+            4 => Some(Self::HihatOpen),
+            5 => Some(Self::TomLow),
+            6 => Some(Self::TomMid),
+            7 => Some(Self::TomHi),
+            8 => Some(Self::Rimshot),
+            9 => Some(Self::Cowbell),
+            10 => Some(Self::Cymbal),
+            _ => None,
+        }
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+#[repr(u8)]
+pub enum DrumKit {
+    #[default]
+    Tr808 = 0,
+    Tr909,
+    Tr707,
+    Cr78,
+    LinnDrum,
+}
+
+impl DrumKit {
+    pub fn from_u8(value: u8) -> Self {
+        match value {
+            1 => Self::Tr909,
+            2 => Self::Tr707,
+            3 => Self::Cr78,
+            4 => Self::LinnDrum,
+            _ => Self::Tr808,
+        }
+    }
+}
+
+/// Kit-specific synthesis parameters (mirrors KIT_PARAMS in the web app)
+struct KitParams {
+    // kick: start/end freq (Hz), decay (s), click amount, drive amount
+    kick: (f32, f32, f32, f32, f32),
+    // snare: tone freq, noise HPF freq, decay, snappy
+    snare: (f32, f32, f32, f32),
+    // clap: bandpass freq, decay, burst spread (s)
+    clap: (f32, f32, f32),
+    // hihat: freq, decay, tone
+    hihat: (f32, f32, f32),
+    // tom: freq multiplier, decay, attack
+    tom: (f32, f32, f32),
+    // rimshot: freq, decay, click
+    rimshot: (f32, f32, f32),
+    // cowbell: freq1, freq2, decay
+    cowbell: (f32, f32, f32),
+    // cymbal: freq, decay, shimmer
+    cymbal: (f32, f32, f32),
+}
+
+const KIT_PARAMS: [KitParams; 5] = [
+    // TR-808: deep, boomy
+    KitParams {
+        kick: (150.0, 30.0, 0.5, 0.1, 0.0),
+        snare: (200.0, 2000.0, 0.2, 0.8),
+        clap: (1200.0, 0.25, 0.01),
+        hihat: (10000.0, 0.08, 0.3),
+        tom: (1.0, 0.4, 0.01),
+        rimshot: (500.0, 0.02, 0.3),
+        cowbell: (587.0, 845.0, 0.3),
+        cymbal: (6000.0, 1.5, 0.3),
+    },
+    // TR-909: punchy, aggressive
+    KitParams {
+        kick: (200.0, 45.0, 0.35, 0.3, 0.2),
+        snare: (180.0, 3000.0, 0.15, 1.0),
+        clap: (1500.0, 0.2, 0.015),
+        hihat: (12000.0, 0.05, 0.5),
+        tom: (1.2, 0.3, 0.005),
+        rimshot: (600.0, 0.015, 0.5),
+        cowbell: (620.0, 890.0, 0.25),
+        cymbal: (8000.0, 1.2, 0.5),
+    },
+    // TR-707: clean, tight
+    KitParams {
+        kick: (180.0, 50.0, 0.25, 0.2, 0.1),
+        snare: (220.0, 2500.0, 0.12, 0.7),
+        clap: (1800.0, 0.15, 0.008),
+        hihat: (11000.0, 0.04, 0.4),
+        tom: (1.1, 0.25, 0.003),
+        rimshot: (550.0, 0.012, 0.4),
+        cowbell: (600.0, 870.0, 0.2),
+        cymbal: (7000.0, 1.0, 0.4),
+    },
+    // CR-78: vintage, warm
+    KitParams {
+        kick: (120.0, 35.0, 0.4, 0.05, 0.0),
+        snare: (180.0, 1800.0, 0.18, 0.5),
+        clap: (1000.0, 0.2, 0.02),
+        hihat: (8000.0, 0.06, 0.2),
+        tom: (0.9, 0.35, 0.015),
+        rimshot: (450.0, 0.025, 0.2),
+        cowbell: (560.0, 800.0, 0.35),
+        cymbal: (5500.0, 1.8, 0.2),
+    },
+    // LinnDrum: punchy, crisp
+    KitParams {
+        kick: (170.0, 40.0, 0.3, 0.4, 0.15),
+        snare: (200.0, 3500.0, 0.18, 0.9),
+        clap: (1600.0, 0.18, 0.012),
+        hihat: (13000.0, 0.045, 0.6),
+        tom: (1.15, 0.28, 0.004),
+        rimshot: (580.0, 0.018, 0.6),
+        cowbell: (640.0, 920.0, 0.22),
+        cymbal: (9000.0, 1.1, 0.6),
+    },
+];
+
+/// Per-sample decay coefficient that reaches -60 dB after `seconds`
+fn decay_coef(seconds: f32, sample_rate: f32) -> f32 {
+    (0.001_f32).powf(1.0 / (seconds.max(0.001) * sample_rate))
+}
+
+/// The Chamberlin SVF in filter.rs is only stable up to roughly fs/6 even
+/// with its internal 2x iteration; hat/cymbal centre frequencies from the
+/// kit tables sit well above that, so clamp before handing them over.
+fn stable_cutoff(freq: f32, sample_rate: f32) -> f32 {
+    freq.min(sample_rate * 0.15)
+}
+
+fn square(phase: f32) -> f32 {
+    if phase - phase.floor() < 0.5 { 1.0 } else { -1.0 }
+}
+
+fn triangle(phase: f32) -> f32 {
+    let p = phase - phase.floor();
+    if p < 0.25 {
+        4.0 * p
+    } else if p < 0.75 {
+        2.0 - 4.0 * p
+    } else {
+        4.0 * p - 4.0
+    }
+}
+
+/// One sounding hit. A single generic state covers all eleven sounds: a
+/// swept main oscillator, a secondary oscillator (click/metal/shimmer/second
+/// cowbell partial), and a filtered noise source, each with its own
+/// exponential amplitude decay.
+struct DrumVoice {
+    sound: DrumSound,
+    active: bool,
+    /// Monotonic trigger counter value, for oldest-voice stealing
+    start_order: u64,
+    /// Samples since trigger
+    t: u32,
+    /// Samples until forced stop
+    duration: u32,
+
+    // Main oscillator: phase accumulator with an exponential freq sweep
+    phase: f32,
+    freq: f32,
+    freq_target: f32,
+    freq_coef: f32,
+    amp: f32,
+    amp_coef: f32,
+
+    // Secondary oscillator
+    phase2: f32,
+    freq2: f32,
+    amp2: f32,
+    amp2_coef: f32,
+
+    // Noise source with two filters in series (bandpass then highpass for
+    // hats/cymbal; snare/rimshot use only the highpass stage)
+    noise: NoiseGen,
+    noise_amp: f32,
+    noise_amp_coef: f32,
+    filter1: StateVariableFilter,
+    filter2: StateVariableFilter,
+    use_filter1: bool,
+    use_filter2: bool,
+
+    // Kick drive (0 = clean)
+    drive: f32,
+
+    // Clap burst retriggering
+    clap_spread: u32,
+    clap_level: f32,
+
+    sample_rate: f32,
+}
+
+impl DrumVoice {
+    fn new(sample_rate: f32) -> Self {
+        Self {
+            sound: DrumSound::Kick,
+            active: false,
+            start_order: 0,
+            t: 0,
+            duration: 0,
+            phase: 0.0,
+            freq: 0.0,
+            freq_target: 0.0,
+            freq_coef: 1.0,
+            amp: 0.0,
+            amp_coef: 1.0,
+            phase2: 0.0,
+            freq2: 0.0,
+            amp2: 0.0,
+            amp2_coef: 1.0,
+            noise: NoiseGen::new(),
+            noise_amp: 0.0,
+            noise_amp_coef: 1.0,
+            filter1: StateVariableFilter::new(sample_rate),
+            filter2: StateVariableFilter::new(sample_rate),
+            use_filter1: false,
+            use_filter2: false,
+            drive: 0.0,
+            clap_spread: 0,
+            clap_level: 0.0,
+            sample_rate,
+        }
+    }
+
+    fn set_sample_rate(&mut self, sample_rate: f32) {
+        self.sample_rate = sample_rate;
+        self.filter1.set_sample_rate(sample_rate);
+        self.filter2.set_sample_rate(sample_rate);
+    }
+
+    fn trigger(&mut self, sound: DrumSound, velocity: f32, kit: &KitParams) {
+        let sr = self.sample_rate;
+        let vel = velocity.clamp(0.1, 1.0);
+
+        self.sound = sound;
+        self.active = true;
+        self.t = 0;
+        self.phase = 0.0;
+        self.phase2 = 0.0;
+        self.amp2 = 0.0;
+        self.noise_amp = 0.0;
+        self.drive = 0.0;
+        self.clap_spread = 0;
+        self.use_filter1 = false;
+        self.use_filter2 = false;
+        self.filter1.reset();
+        self.filter2.reset();
+
+        match sound {
+            DrumSound::Kick => {
+                let (start, end, decay, click, drive) = kit.kick;
+                self.freq = start * (0.8 + vel * 0.4);
+                self.freq_target = end;
+                // Sweep reaches the end frequency in roughly decay*0.6
+                self.freq_coef = (end / self.freq).powf(1.0 / (decay * 0.6 * sr));
+                self.amp = vel * 1.2;
+                self.amp_coef = decay_coef(decay, sr);
+                self.drive = drive;
+                if click > 0.0 {
+                    self.freq2 = start * 3.0;
+                    self.amp2 = vel * click * 0.5;
+                    self.amp2_coef = decay_coef(0.01, sr);
+                }
+                self.duration = ((decay + 0.1) * sr) as u32;
+            }
+            DrumSound::Snare => {
+                let (tone, noise_hpf, decay, snappy) = kit.snare;
+                self.freq = tone * 1.2;
+                self.freq_target = tone * 0.5;
+                self.freq_coef = (self.freq_target / self.freq).powf(1.0 / (decay * 0.5 * sr));
+                self.amp = vel * 0.5;
+                self.amp_coef = decay_coef(decay * 0.7, sr);
+                self.noise_amp = vel * snappy;
+                self.noise_amp_coef = decay_coef(decay, sr);
+                self.filter2.filter_type = FilterType::HighPass;
+                self.filter2.cutoff = stable_cutoff(noise_hpf, sr);
+                self.use_filter2 = true;
+                self.duration = (decay * 1.5 * sr) as u32;
+            }
+            DrumSound::Clap => {
+                let (bp_freq, decay, spread) = kit.clap;
+                self.clap_spread = (spread * sr).max(1.0) as u32;
+                self.clap_level = vel * 0.5;
+                self.noise_amp = self.clap_level;
+                self.noise_amp_coef = decay_coef(decay, sr);
+                self.filter1.filter_type = FilterType::BandPass;
+                self.filter1.cutoff = stable_cutoff(bp_freq, sr);
+                self.filter1.resonance = 0.5;
+                self.use_filter1 = true;
+                self.duration = (decay * 1.5 * sr) as u32;
+            }
+            DrumSound::HihatClosed | DrumSound::HihatOpen => {
+                let (freq, decay, tone) = kit.hihat;
+                let open = sound == DrumSound::HihatOpen;
+                let dur = if open { decay * 5.0 } else { decay };
+                self.noise_amp = vel * 0.4;
+                self.noise_amp_coef = decay_coef(dur, sr);
+                self.filter1.filter_type = FilterType::BandPass;
+                self.filter1.cutoff = stable_cutoff(freq, sr);
+                self.filter1.resonance = (tone * 0.5).min(0.9);
+                self.use_filter1 = true;
+                self.filter2.filter_type = FilterType::HighPass;
+                self.filter2.cutoff = stable_cutoff(freq * 0.7, sr);
+                self.use_filter2 = true;
+                // Tonal component for the more metallic kits
+                if tone > 0.4 {
+                    self.freq2 = freq * 0.4;
+                    self.amp2 = vel * (tone - 0.3) * 0.15;
+                    self.amp2_coef = decay_coef(dur * 0.5, sr);
+                }
+                self.duration = ((dur + 0.1) * sr) as u32;
+            }
+            DrumSound::TomLow | DrumSound::TomMid | DrumSound::TomHi => {
+                let (mult, decay, attack) = kit.tom;
+                let base = match sound {
+                    DrumSound::TomLow => 80.0,
+                    DrumSound::TomMid => 120.0,
+                    _ => 160.0,
+                };
+                let freq = base * mult;
+                self.freq = freq * 1.5;
+                self.freq_target = freq * 0.8;
+                self.freq_coef = (self.freq_target / self.freq).powf(1.0 / (decay * 0.8 * sr));
+                self.amp = vel * 0.8;
+                self.amp_coef = decay_coef(decay, sr);
+                // Click transient for the punchier kits
+                if attack < 0.008 {
+                    self.freq2 = freq * 2.0;
+                    self.amp2 = vel * 0.3;
+                    self.amp2_coef = decay_coef(0.01, sr);
+                }
+                self.duration = ((decay + 0.1) * sr) as u32;
+            }
+            DrumSound::Rimshot => {
+                let (freq, decay, click) = kit.rimshot;
+                self.freq = freq;
+                self.freq_target = freq;
+                self.freq_coef = 1.0;
+                self.amp = vel * click;
+                self.amp_coef = decay_coef(decay, sr);
+                self.noise_amp = vel * 0.5;
+                self.noise_amp_coef = decay_coef(decay * 1.5, sr);
+                self.filter2.filter_type = FilterType::HighPass;
+                self.filter2.cutoff = stable_cutoff(4000.0, sr);
+                self.use_filter2 = true;
+                self.duration = (decay * 2.0 * sr) as u32;
+            }
+            DrumSound::Cowbell => {
+                let (f1, f2, decay) = kit.cowbell;
+                self.freq = f1;
+                self.freq_target = f1;
+                self.freq_coef = 1.0;
+                self.amp = vel * 0.25;
+                self.amp_coef = decay_coef(decay, sr);
+                self.freq2 = f2;
+                self.amp2 = vel * 0.25;
+                self.amp2_coef = self.amp_coef;
+                // One bandpass shapes both partials (centre between them)
+                self.filter1.filter_type = FilterType::BandPass;
+                self.filter1.cutoff = stable_cutoff((f1 + f2) * 0.5, sr);
+                self.filter1.resonance = 0.8;
+                self.use_filter1 = true;
+                self.duration = ((decay + 0.05) * sr) as u32;
+            }
+            DrumSound::Cymbal => {
+                let (freq, decay, shimmer) = kit.cymbal;
+                self.noise_amp = vel * 0.5;
+                self.noise_amp_coef = decay_coef(decay, sr);
+                self.filter1.filter_type = FilterType::BandPass;
+                self.filter1.cutoff = stable_cutoff(freq, sr);
+                self.filter1.resonance = 0.3;
+                self.use_filter1 = true;
+                self.filter2.filter_type = FilterType::HighPass;
+                self.filter2.cutoff = stable_cutoff(freq * 0.7, sr);
+                self.use_filter2 = true;
+                if shimmer > 0.3 {
+                    self.freq2 = freq * 1.5;
+                    self.amp2 = vel * shimmer * 0.1;
+                    self.amp2_coef = decay_coef(decay * 0.7, sr);
+                }
+                self.duration = ((decay + 0.5) * sr) as u32;
+            }
+        }
+    }
+
+    #[inline]
+    fn tick(&mut self) -> f32 {
+        if !self.active {
+            return 0.0;
+        }
+
+        let mut out = 0.0;
+
+        // Main oscillator with exponential frequency sweep
+        if self.amp > 0.0005 {
+            let osc = match self.sound {
+                DrumSound::Snare => triangle(self.phase),
+                DrumSound::Rimshot | DrumSound::Cowbell => square(self.phase),
+                _ => tables::sin_norm(self.phase),
+            };
+            out += osc * self.amp;
+            self.phase += self.freq / self.sample_rate;
+            self.phase -= self.phase.floor();
+            self.amp *= self.amp_coef;
+            if (self.freq_coef < 1.0 && self.freq > self.freq_target)
+                || (self.freq_coef > 1.0 && self.freq < self.freq_target)
+            {
+                self.freq *= self.freq_coef;
+            }
+        }
+
+        // Secondary oscillator (click / metal / shimmer / second partial)
+        if self.amp2 > 0.0005 {
+            let osc2 = match self.sound {
+                DrumSound::Cymbal => tables::sin_norm(self.phase2),
+                DrumSound::TomLow | DrumSound::TomMid | DrumSound::TomHi => triangle(self.phase2),
+                _ => square(self.phase2),
+            };
+            out += osc2 * self.amp2;
+            self.phase2 += self.freq2 / self.sample_rate;
+            self.phase2 -= self.phase2.floor();
+            self.amp2 *= self.amp2_coef;
+        }
+
+        // Filtered noise
+        if self.noise_amp > 0.0005 {
+            let mut n = self.noise.tick();
+            if self.use_filter1 {
+                n = self.filter1.tick(n);
+            }
+            if self.use_filter2 {
+                n = self.filter2.tick(n);
+            }
+            out += n * self.noise_amp;
+            self.noise_amp *= self.noise_amp_coef;
+
+            // Clap: retrigger the burst envelope twice after the first hit
+            if self.clap_spread > 0
+                && (self.t == self.clap_spread || self.t == 2 * self.clap_spread)
+            {
+                self.noise_amp = self.clap_level;
+            }
+        }
+
+        // Kick drive: cheap symmetric soft clip
+        if self.drive > 0.0 {
+            let d = 1.0 + self.drive * 4.0;
+            out = (d * out) / (1.0 + (d * out).abs()) * (1.0 + self.drive);
+        }
+
+        self.t += 1;
+        if self.t >= self.duration {
+            self.active = false;
+        }
+
+        out
+    }
+}
+
+/// TR-style drum machine: fixed voice pool, one batched render pass
+pub struct DrumMachine {
+    voices: Vec<DrumVoice>,
+    kit: DrumKit,
+    master_volume: f32,
+    sample_rate: f32,
+    trigger_counter: u64,
+}
+
+impl DrumMachine {
+    pub fn new(sample_rate: f32) -> Self {
+        Self {
+            voices: (0..MAX_DRUM_VOICES).map(|_| DrumVoice::new(sample_rate)).collect(),
+            kit: DrumKit::default(),
+            master_volume: 0.8,
+            sample_rate,
+            trigger_counter: 0,
+        }
+    }
+
+    pub fn set_sample_rate(&mut self, sample_rate: f32) {
+        self.sample_rate = sample_rate;
+        for voice in &mut self.voices {
+            voice.set_sample_rate(sample_rate);
+        }
+    }
+
+    pub fn set_kit(&mut self, kit: DrumKit) {
+        self.kit = kit;
+    }
+
+    pub fn set_master_volume(&mut self, volume: f32) {
+        self.master_volume = volume.clamp(0.0, 1.0);
+    }
+
+    pub fn active_voice_count(&self) -> usize {
+        self.voices.iter().filter(|v| v.active).count()
+    }
+
+    pub fn all_notes_off(&mut self) {
+        for voice in &mut self.voices {
+            voice.active = false;
+        }
+    }
+
+    /// Fire a hit now. A retrigger of the same sound steals its own voice
+    /// (and a closed hat chokes an open one, TR-style); otherwise the
+    /// oldest voice goes.
+    pub fn trigger(&mut self, sound: DrumSound, velocity: f32) {
+        self.trigger_counter += 1;
+        let serial = self.trigger_counter;
+
+        if sound == DrumSound::HihatClosed {
+            for voice in &mut self.voices {
+                if voice.active && voice.sound == DrumSound::HihatOpen {
+                    voice.active = false;
+                }
+            }
+        }
+
+        let idx = self
+            .voices
+            .iter()
+            .position(|v| v.active && v.sound == sound)
+            .or_else(|| self.voices.iter().position(|v| !v.active))
+            .unwrap_or_else(|| {
+                self.voices
+                    .iter()
+                    .enumerate()
+                    .min_by_key(|(_, v)| v.start_order)
+                    .map(|(i, _)| i)
+                    .unwrap_or(0)
+            });
+
+        let kit = &KIT_PARAMS[self.kit as usize];
+        self.voices[idx].trigger(sound, velocity, kit);
+        self.voices[idx].start_order = serial;
+    }
+
+    /// Render a block (mono). One pass over the buffer: per sample, every
+    /// active voice is ticked and summed — no per-voice buffer traversal,
+    /// so a whole step's worth of hits costs a single pass.
+    pub fn process(&mut self, out: &mut [f32]) {
+        for sample in out.iter_mut() {
+            let mut mix = 0.0;
+            for voice in &mut self.voices {
+                mix += voice.tick();
+            }
+            *sample = mix * self.master_volume;
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_all_sounds_render() {
+        for sound_idx in 0..11u8 {
+            let mut dm = DrumMachine::new(44100.0);
+            dm.trigger(DrumSound::from_u8(sound_idx).unwrap(), 1.0);
+
+            let mut buf = vec![0.0f32; 4096];
+            dm.process(&mut buf);
+            assert!(buf.iter().all(|s| s.is_finite()), "sound {} NaN", sound_idx);
+            assert!(buf.iter().any(|s| *s != 0.0), "sound {} silent", sound_idx);
+        }
+    }
+
+    #[test]
+    fn test_all_kits_render() {
+        for kit in 0..5u8 {
+            let mut dm = DrumMachine::new(44100.0);
+            dm.set_kit(DrumKit::from_u8(kit));
+            dm.trigger(DrumSound::Kick, 1.0);
+            dm.trigger(DrumSound::Snare, 0.8);
+            dm.trigger(DrumSound::HihatClosed, 0.6);
+
+            let mut buf = vec![0.0f32; 4096];
+            dm.process(&mut buf);
+            assert!(buf.iter().all(|s| s.is_finite()));
+            assert!(buf.iter().any(|s| *s != 0.0));
+        }
+    }
+
+    #[test]
+    fn test_closed_hat_chokes_open() {
+        let mut dm = DrumMachine::new(44100.0);
+        dm.trigger(DrumSound::HihatOpen, 1.0);
+        assert_eq!(dm.active_voice_count(), 1);
+        dm.trigger(DrumSound::HihatClosed, 1.0);
+        assert!(!dm.voices.iter().any(|v| v.active && v.sound == DrumSound::HihatOpen));
+    }
+
+    #[test]
+    fn test_voices_expire() {
+        let mut dm = DrumMachine::new(44100.0);
+        dm.trigger(DrumSound::Rimshot, 1.0);
+        let mut buf = vec![0.0f32; 44100];
+        dm.process(&mut buf);
+        assert_eq!(dm.active_voice_count(), 0);
+    }
+}
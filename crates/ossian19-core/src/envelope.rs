@@ -30,6 +30,11 @@ pub struct Envelope {
     sample_rate: f32,
     #[serde(skip)]
     release_level: f32,
+    /// Set by shed(): the remaining release runs at SHED_RELEASE_SECONDS
+    /// instead of `release`, so the voice fades out almost immediately.
+    /// Cleared by the next trigger.
+    #[serde(skip)]
+    shedding: bool,
 }
 
 impl Default for Envelope {
@@ -43,10 +48,15 @@ impl Default for Envelope {
             level: 0.0,
             sample_rate: 44100.0,
             release_level: 0.0,
+            shedding: false,
         }
     }
 }
 
+/// Release time applied by shed(): fast enough to free the voice within a
+/// couple of blocks, slow enough not to click
+const SHED_RELEASE_SECONDS: f32 = 0.02;
+
 impl Envelope {
     pub fn new(sample_rate: f32) -> Self {
         Self {
@@ -62,6 +72,7 @@ impl Envelope {
     /// Trigger the envelope (note on)
     pub fn trigger(&mut self) {
         self.stage = EnvelopeStage::Attack;
+        self.shedding = false;
         // Don't reset level - allows retriggering from current position
     }
 
@@ -73,6 +84,23 @@ impl Envelope {
         }
     }
 
+    /// Collapse the remaining release to SHED_RELEASE_SECONDS (used by the
+    /// CPU budgeter to drop quiet tails under deadline pressure). The
+    /// patch's `release` setting is untouched; the next trigger restores
+    /// normal behavior.
+    pub fn shed(&mut self) {
+        if self.stage != EnvelopeStage::Idle {
+            self.stage = EnvelopeStage::Release;
+            self.release_level = self.level;
+            self.shedding = true;
+        }
+    }
+
+    /// Is this envelope already fading out via shed()?
+    pub fn is_shedding(&self) -> bool {
+        self.shedding
+    }
+
     /// Check if envelope has finished
     pub fn is_idle(&self) -> bool {
         self.stage == EnvelopeStage::Idle
@@ -114,7 +142,8 @@ impl Envelope {
                 self.level = self.sustain;
             }
             EnvelopeStage::Release => {
-                let rate = self.calculate_rate(self.release);
+                let time = if self.shedding { SHED_RELEASE_SECONDS } else { self.release };
+                let rate = self.calculate_rate(time);
                 self.level -= rate * self.release_level;
                 // Use threshold to avoid denormals and long tails
                 if self.level <= 0.0001 {
@@ -141,6 +170,7 @@ impl Envelope {
         self.stage = EnvelopeStage::Idle;
         self.level = 0.0;
         self.release_level = 0.0;
+        self.shedding = false;
     }
 }
 
@@ -185,4 +215,28 @@ mod tests {
         }
         assert!(env.is_idle());
     }
+
+    #[test]
+    fn test_shed_collapses_release() {
+        let mut env = Envelope::new(1000.0);
+        env.attack = 0.001;
+        env.release = 10.0; // Way too long to shed naturally
+        env.trigger();
+        for _ in 0..5 {
+            env.tick();
+        }
+        env.release();
+        env.shed();
+        assert!(env.is_shedding());
+
+        // 20 ms shed time at 1000 Hz is 20 samples; allow some slack
+        for _ in 0..30 {
+            env.tick();
+        }
+        assert!(env.is_idle());
+
+        // Retrigger clears the shed flag so the patch release applies again
+        env.trigger();
+        assert!(!env.is_shedding());
+    }
 }
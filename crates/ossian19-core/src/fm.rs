@@ -3,9 +3,11 @@
 
 use std::f32::consts::PI;
 use serde::{Deserialize, Serialize};
-use crate::envelope::Envelope;
+use crate::envelope::{Envelope, EnvelopeStage};
 use crate::filter::LadderFilter;
 use crate::lfo::Lfo;
+use crate::pool::{SharedPtr, WorkerPool};
+use crate::voice::StealPolicy;
 
 const TWO_PI: f32 = 2.0 * PI;
 
@@ -15,6 +17,10 @@ pub struct FmOscillator {
     phase: f32,
     phase_increment: f32,
     frequency: f32,
+    /// Pitch-bend factor folded into the phase increment. Kept separate
+    /// from `frequency` so repeated bend updates scale the stored base
+    /// frequency once each instead of compounding into it.
+    bend: f32,
     sample_rate: f32,
 }
 
@@ -24,6 +30,7 @@ impl FmOscillator {
             phase: 0.0,
             phase_increment: 0.0,
             frequency: 440.0,
+            bend: 1.0,
             sample_rate,
         }
     }
@@ -38,14 +45,24 @@ impl FmOscillator {
         self.update_phase_increment();
     }
 
+    /// Multiply a pitch-bend factor into the phase increment. This is one
+    /// multiply per oscillator — no note-frequency or detune recompute —
+    /// which is what keeps a bend sweep cheap across a full voice pool.
+    pub fn set_bend(&mut self, bend: f32) {
+        self.bend = bend;
+        self.update_phase_increment();
+    }
+
     fn update_phase_increment(&mut self) {
-        self.phase_increment = self.frequency / self.sample_rate;
+        self.phase_increment = self.frequency * self.bend / self.sample_rate;
     }
 
     /// Generate sample with phase modulation input (in radians)
     #[inline]
     pub fn tick(&mut self, phase_mod: f32) -> f32 {
-        let output = (self.phase * TWO_PI + phase_mod).sin();
+        // Shared process-wide sine table; this is the hottest call in the
+        // FM render loop (6 operators x voices x samples)
+        let output = crate::tables::sin_norm(self.phase + phase_mod * (1.0 / TWO_PI));
 
         // Advance phase
         self.phase += self.phase_increment;
@@ -80,6 +97,10 @@ pub struct FmOperator {
     // Runtime state
     velocity: f32,
     feedback_sample: f32,
+    /// Final output of the most recent tick (post envelope/level/velocity).
+    /// Lets multi-output render paths tap individual carriers without
+    /// changing the algorithm routing code.
+    pub last_output: f32,
 }
 
 impl FmOperator {
@@ -94,6 +115,7 @@ impl FmOperator {
             feedback: 0.0,
             velocity: 1.0,
             feedback_sample: 0.0,
+            last_output: 0.0,
         }
     }
 
@@ -139,7 +161,8 @@ impl FmOperator {
         // Apply velocity sensitivity
         let vel_scale = 1.0 - self.velocity_sens + self.velocity_sens * self.velocity;
 
-        osc_out * env * self.level * vel_scale
+        self.last_output = osc_out * env * self.level * vel_scale;
+        self.last_output
     }
 
     /// Check if operator envelope is finished
@@ -151,6 +174,7 @@ impl FmOperator {
         self.oscillator.reset();
         self.envelope.reset();
         self.feedback_sample = 0.0;
+        self.last_output = 0.0;
     }
 }
 
@@ -854,6 +878,11 @@ pub struct Fm6OpVoice {
     note: u8,
     velocity: f32,
     active: bool,
+    /// MIDI channel the note-on arrived on (0-15), so per-channel (MPE)
+    /// pitch bend can find its voices
+    channel: u8,
+    /// Manager note counter value at note-on, for oldest-first stealing
+    start_order: u64,
     sample_rate: f32,
 }
 
@@ -898,6 +927,8 @@ impl Fm6OpVoice {
             note: 0,
             velocity: 0.0,
             active: false,
+            channel: 0,
+            start_order: 0,
             sample_rate,
         }
     }
@@ -910,6 +941,25 @@ impl Fm6OpVoice {
         self.filter.set_sample_rate(sample_rate);
     }
 
+    /// Fold a pitch-bend factor into every operator's phase increment
+    fn set_bend(&mut self, bend: f32) {
+        for op in &mut self.operators {
+            op.oscillator.set_bend(bend);
+        }
+    }
+
+    /// Rough audible level of this voice (carrier envelopes x velocity),
+    /// used to pick the quietest voice when stealing
+    fn audible_level(&self) -> f32 {
+        let sum: f32 = self
+            .algorithm
+            .carriers()
+            .iter()
+            .map(|&i| self.operators[i].envelope.level() * self.operators[i].level)
+            .sum();
+        sum * self.velocity
+    }
+
     pub fn note_on(&mut self, note: u8, velocity: f32) {
         self.note = note;
         self.velocity = velocity;
@@ -1310,7 +1360,33 @@ pub struct Fm6OpVoiceManager {
     sample_rate: f32,
     vibrato_lfo: Lfo,
     vibrato_depth: f32,
+    /// Pitch bend per MIDI channel, in semitones. Single-channel streams
+    /// land everything in one slot, which behaves like a global bend; MPE
+    /// streams get per-note bend via their member channels.
+    channel_bend: [f32; 16],
+    /// Pitch bend range in semitones (default: 2)
+    pitch_bend_range: f32,
     master_volume: f32,
+    /// Smoothed copy of master_volume; render paths read this so sparse
+    /// setter calls (UI-rate parameter pushes) stay click-free
+    volume_smooth: crate::smoother::SmoothedParam,
+    smoothing_ms: f32,
+    /// How many of the allocated voices may sound at once
+    max_polyphony: usize,
+    steal_policy: StealPolicy,
+    /// Incremented on every note-on; stamps voices for oldest-first stealing
+    note_counter: u64,
+    /// Worker threads for voice rendering (1 = single-threaded)
+    num_threads: usize,
+    /// Per-thread mix buffers for the parallel render path
+    thread_buffers: Vec<Vec<f32>>,
+    /// Per-sample vibrato multipliers, precomputed once per parallel block
+    vibrato_buffer: Vec<f32>,
+    /// Persistent workers for the parallel path (None until a multi-thread
+    /// split is requested); parked between blocks, never spawned per block
+    worker_pool: Option<WorkerPool>,
+    /// Faster-than-realtime bounce mode (relaxes the parallel block gate)
+    offline: bool,
 }
 
 impl Fm6OpVoiceManager {
@@ -1323,26 +1399,218 @@ impl Fm6OpVoiceManager {
             sample_rate,
             vibrato_lfo,
             vibrato_depth: 0.0,
+            channel_bend: [0.0; 16],
+            pitch_bend_range: 2.0, // ±2 semitones default
             master_volume: 0.7,
+            volume_smooth: {
+                let mut p = crate::smoother::SmoothedParam::new(0.7);
+                p.set_time(crate::smoother::DEFAULT_SMOOTHING_MS, sample_rate);
+                p
+            },
+            smoothing_ms: crate::smoother::DEFAULT_SMOOTHING_MS,
+            max_polyphony: num_voices,
+            steal_policy: StealPolicy::default(),
+            note_counter: 0,
+            num_threads: 1,
+            thread_buffers: Vec::new(),
+            vibrato_buffer: Vec::new(),
+            worker_pool: None,
+            offline: false,
         }
     }
 
-    fn allocate_voice(&mut self) -> Option<&mut Fm6OpVoice> {
-        let inactive_idx = self.voices.iter().position(|v| !v.is_active());
-        if let Some(idx) = inactive_idx {
+    /// Cap how many voices may sound at once (clamped to the allocated pool).
+    /// Voices above the cap are silenced immediately. No allocation happens
+    /// here, so this is safe to call from the audio thread.
+    pub fn set_max_polyphony(&mut self, max: usize) {
+        self.max_polyphony = max.clamp(1, self.voices.len());
+        for voice in &mut self.voices[self.max_polyphony..] {
+            if voice.is_active() {
+                voice.reset();
+            }
+        }
+    }
+
+    pub fn max_polyphony(&self) -> usize {
+        self.max_polyphony
+    }
+
+    pub fn set_steal_policy(&mut self, policy: StealPolicy) {
+        self.steal_policy = policy;
+    }
+
+    /// Update the sample rate in place. Reconfigures every voice and the
+    /// vibrato LFO without reallocating, so it is safe to call from
+    /// prepareToPlay-style host callbacks.
+    pub fn set_sample_rate(&mut self, sample_rate: f32) {
+        self.sample_rate = sample_rate;
+        for voice in &mut self.voices {
+            voice.set_sample_rate(sample_rate);
+        }
+        self.vibrato_lfo.set_sample_rate(sample_rate);
+        self.volume_smooth.set_time(self.smoothing_ms, sample_rate);
+    }
+
+    /// Glide window for the smoothed master volume. 0 disables smoothing;
+    /// values snap immediately.
+    pub fn set_smoothing_ms(&mut self, ms: f32) {
+        self.smoothing_ms = ms.clamp(0.0, 100.0);
+        self.volume_smooth.set_time(self.smoothing_ms, self.sample_rate);
+    }
+
+    /// Jump the smoothed parameters straight to their targets. Preset
+    /// applies call this so a patch change doesn't glide from the old one.
+    pub fn snap_smoothed(&mut self) {
+        self.volume_smooth.snap();
+    }
+
+    /// Find a free voice within the polyphony cap, or steal one per the
+    /// configured policy
+    fn allocate_voice(&mut self, note: u8) -> Option<&mut Fm6OpVoice> {
+        let limit = self.max_polyphony.min(self.voices.len());
+        let pool = &self.voices[..limit];
+
+        if let Some(idx) = pool.iter().position(|v| !v.is_active()) {
             return self.voices.get_mut(idx);
         }
-        self.voices.first_mut()
+
+        fn oldest(pool: &[Fm6OpVoice]) -> usize {
+            pool.iter()
+                .enumerate()
+                .min_by_key(|(_, v)| v.start_order)
+                .map(|(i, _)| i)
+                .unwrap_or(0)
+        }
+
+        let idx = match self.steal_policy {
+            StealPolicy::Oldest => oldest(pool),
+            StealPolicy::Quietest => pool
+                .iter()
+                .enumerate()
+                .min_by(|(_, a), (_, b)| {
+                    a.audible_level()
+                        .partial_cmp(&b.audible_level())
+                        .unwrap_or(std::cmp::Ordering::Equal)
+                })
+                .map(|(i, _)| i)
+                .unwrap_or(0),
+            StealPolicy::SameNote => pool
+                .iter()
+                .position(|v| v.note() == note)
+                .unwrap_or_else(|| oldest(pool)),
+        };
+        self.voices.get_mut(idx)
     }
 
     pub fn note_on(&mut self, note: u8, velocity: f32) {
+        self.note_on_with_channel(note, velocity, 0);
+    }
+
+    /// Start a note, tagging the voice with its source MIDI channel so
+    /// per-channel (MPE) pitch bend can find it later
+    pub fn note_on_with_channel(&mut self, note: u8, velocity: f32, channel: u8) {
+        let channel = channel & 15;
+        let bend = self.bend_factor(channel);
+        self.note_counter += 1;
+        let serial = self.note_counter;
+
         if let Some(voice) = self.voices.iter_mut().find(|v| v.is_active() && v.note() == note) {
+            voice.start_order = serial;
+            voice.channel = channel;
             voice.note_on(note, velocity);
+            voice.set_bend(bend);
             return;
         }
-        if let Some(voice) = self.allocate_voice() {
+        if let Some(voice) = self.allocate_voice(note) {
+            voice.start_order = serial;
+            voice.channel = channel;
             voice.note_on(note, velocity);
+            voice.set_bend(bend);
+        }
+    }
+
+    /// Set pitch bend value (-1 to 1, where 1 = +pitch_bend_range semitones),
+    /// applied to every channel. One 2^(st/12) factor is computed here and
+    /// multiplied into the sounding oscillators' phase increments — no
+    /// per-voice note-frequency recompute — so a bend sweep costs the same
+    /// across 16 voices as across one.
+    pub fn set_pitch_bend(&mut self, value: f32) {
+        let semitones = value.clamp(-1.0, 1.0) * self.pitch_bend_range;
+        self.channel_bend = [semitones; 16];
+        let factor = (2.0_f32).powf(semitones / 12.0);
+        for voice in &mut self.voices {
+            if voice.is_active() {
+                voice.set_bend(factor);
+            }
+        }
+    }
+
+    /// Per-channel variant of set_pitch_bend: only voices whose note-on
+    /// arrived on `channel` are retuned. With one note per channel (MPE
+    /// member channels) this gives per-note bend.
+    pub fn set_pitch_bend_channel(&mut self, channel: u8, value: f32) {
+        let channel = channel & 15;
+        let semitones = value.clamp(-1.0, 1.0) * self.pitch_bend_range;
+        self.channel_bend[channel as usize] = semitones;
+        let factor = (2.0_f32).powf(semitones / 12.0);
+        for voice in &mut self.voices {
+            if voice.is_active() && voice.channel == channel {
+                voice.set_bend(factor);
+            }
+        }
+    }
+
+    /// Set pitch bend range in semitones (typically 2, 12, or 24)
+    pub fn set_pitch_bend_range(&mut self, semitones: f32) {
+        self.pitch_bend_range = semitones.clamp(0.0, 48.0);
+    }
+
+    /// Current bend factor for a channel (for use during note_on)
+    fn bend_factor(&self, channel: u8) -> f32 {
+        (2.0_f32).powf(self.channel_bend[(channel & 15) as usize] / 12.0)
+    }
+
+    /// CPU budgeter escape valve: fade out up to `count` of the quietest
+    /// voices whose carriers are all in their release phase by collapsing
+    /// the remaining release to ~20 ms (Envelope::shed). Held notes are
+    /// never touched, so under deadline pressure long tails go first.
+    /// Returns how many voices were shed.
+    pub fn shed_quietest_release(&mut self, count: usize) -> usize {
+        let mut shed = 0;
+        while shed < count {
+            let mut quietest: Option<usize> = None;
+            let mut quietest_level = f32::MAX;
+            for (i, voice) in self.voices.iter().enumerate() {
+                if !voice.is_active() {
+                    continue;
+                }
+                let carriers = voice.algorithm.carriers();
+                let releasing = carriers.iter().all(|&c| {
+                    voice.operators[c].envelope.stage() == EnvelopeStage::Release
+                });
+                let shedding = carriers
+                    .iter()
+                    .any(|&c| voice.operators[c].envelope.is_shedding());
+                if releasing && !shedding {
+                    let level = voice.audible_level();
+                    if level < quietest_level {
+                        quietest_level = level;
+                        quietest = Some(i);
+                    }
+                }
+            }
+            match quietest {
+                Some(i) => {
+                    let voice = &mut self.voices[i];
+                    for &c in voice.algorithm.carriers() {
+                        voice.operators[c].envelope.shed();
+                    }
+                    shed += 1;
+                }
+                None => break,
+            }
         }
+        shed
     }
 
     pub fn note_off(&mut self, note: u8) {
@@ -1382,7 +1650,195 @@ impl Fm6OpVoiceManager {
             }
             output += voice.tick();
         }
-        output * self.master_volume
+        output * self.volume_smooth.next()
+    }
+
+    /// Render a whole block (mono). Uses the worker-pool path when enabled
+    /// and the block is large enough, otherwise ticks voices serially.
+    pub fn process(&mut self, buffer: &mut [f32]) {
+        if self.use_parallel(buffer.len()) {
+            self.process_parallel(buffer);
+            return;
+        }
+        for sample in buffer.iter_mut() {
+            *sample = self.tick();
+        }
+    }
+
+    /// Render a block (mono) while also writing each operator's summed
+    /// output into the matching `op_outs` slot (`None` entries are skipped).
+    /// The per-operator taps are the raw operator outputs across all voices
+    /// — before the per-voice filter and the algorithm's carrier-mix
+    /// normalization — scaled by master volume, which is what a host wants
+    /// on separate carrier buses. Always renders serially: the worker-pool
+    /// path would need per-thread scratch for every tapped operator, and
+    /// multi-out sessions already save more by running one instance.
+    pub fn process_multi(&mut self, main: &mut [f32], op_outs: &mut [Option<&mut [f32]>; 6]) {
+        for i in 0..main.len() {
+            let vibrato = if self.vibrato_depth > 0.0 {
+                let cents = self.vibrato_lfo.tick() * self.vibrato_depth;
+                (2.0_f32).powf(cents / 1200.0)
+            } else {
+                1.0
+            };
+
+            let mut mix = 0.0;
+            let mut op_mix = [0.0f32; 6];
+            for voice in &mut self.voices {
+                if !voice.is_active() {
+                    continue;
+                }
+                if vibrato != 1.0 {
+                    for op in &mut voice.operators {
+                        let base_freq = op.oscillator.frequency;
+                        op.oscillator.set_frequency(base_freq * vibrato);
+                    }
+                }
+                mix += voice.tick();
+                for (acc, op) in op_mix.iter_mut().zip(voice.operators.iter()) {
+                    *acc += op.last_output;
+                }
+            }
+
+            let master = self.volume_smooth.next();
+            main[i] = mix * master;
+            for (sum, out) in op_mix.iter().zip(op_outs.iter_mut()) {
+                if let Some(buf) = out {
+                    buf[i] = sum * master;
+                }
+            }
+        }
+    }
+
+    /// Opt into worker-pool rendering. Voices are partitioned across
+    /// `num_threads` for blocks of at least PARALLEL_BLOCK_MIN samples;
+    /// 0 or 1 restores the single-threaded path. The workers are persistent
+    /// — parked on a condvar between blocks, never spawned per block — but
+    /// growing the pool spawns OS threads, so call this with the largest
+    /// split you intend to use from a prepare callback; shrinking (and
+    /// re-growing within that ceiling) is render-safe.
+    pub fn set_num_threads(&mut self, num_threads: usize) {
+        self.num_threads = num_threads.clamp(1, 16);
+        // Grow only: prewarm() may have reserved scratch for a larger
+        // split, and process_parallel() slices to num_threads anyway.
+        if self.thread_buffers.len() < self.num_threads {
+            self.thread_buffers.resize_with(self.num_threads, Vec::new);
+        }
+        let workers_needed = self.num_threads - 1;
+        let workers_have = self.worker_pool.as_ref().map_or(0, |p| p.concurrency() - 1);
+        if workers_needed > workers_have {
+            self.worker_pool = Some(WorkerPool::new(workers_needed));
+        }
+    }
+
+    /// Preallocate every per-thread scratch buffer for blocks up to
+    /// `max_block` samples, covering all thread counts set_num_threads()
+    /// can later select, so neither the first parallel block nor a
+    /// mid-session re-split allocates on the audio thread. Voices and
+    /// their operators are fully allocated at construction. Call from a
+    /// prepare callback.
+    pub fn prewarm(&mut self, max_block: usize) {
+        if self.thread_buffers.len() < 16 {
+            self.thread_buffers.resize_with(16, Vec::new);
+        }
+        for scratch in &mut self.thread_buffers {
+            scratch.clear();
+            scratch.reserve(max_block);
+        }
+        // The per-block vibrato multiplier sequence is scratch too
+        self.vibrato_buffer.clear();
+        self.vibrato_buffer.reserve(max_block);
+    }
+
+    /// Mark the engine as rendering faster than realtime (host bounce).
+    /// Offline we only care about throughput, not worst-case callback time,
+    /// so the worker pool is allowed to engage on smaller blocks.
+    pub fn set_offline(&mut self, offline: bool) {
+        self.offline = offline;
+    }
+
+    fn use_parallel(&self, num_samples: usize) -> bool {
+        let min_block = if self.offline {
+            crate::synth::PARALLEL_BLOCK_MIN / 4
+        } else {
+            crate::synth::PARALLEL_BLOCK_MIN
+        };
+        self.num_threads > 1 && num_samples >= min_block
+    }
+
+    /// Render a block with voices partitioned across the persistent worker
+    /// pool. The vibrato multiplier sequence is precomputed once so every
+    /// chunk applies the same per-sample modulation as the serial path;
+    /// beyond that each voice only touches its own state, so chunks are
+    /// independent. Nothing here spawns or allocates once prewarm() has run.
+    fn process_parallel(&mut self, buffer: &mut [f32]) {
+        let num_samples = buffer.len();
+        if self.worker_pool.is_none() {
+            for sample in buffer.iter_mut() {
+                *sample = self.tick();
+            }
+            return;
+        }
+        let pool = self.worker_pool.as_ref().unwrap();
+        let threads = self.num_threads.min(pool.concurrency());
+        for scratch in &mut self.thread_buffers[..threads] {
+            scratch.clear();
+            scratch.resize(num_samples, 0.0);
+        }
+
+        self.vibrato_buffer.clear();
+        if self.vibrato_depth > 0.0 {
+            for _ in 0..num_samples {
+                let cents = self.vibrato_lfo.tick() * self.vibrato_depth;
+                self.vibrato_buffer.push((2.0_f32).powf(cents / 1200.0));
+            }
+        }
+
+        let vibrato: &[f32] = &self.vibrato_buffer;
+        let num_voices = self.voices.len();
+        let chunk_size = (num_voices + threads - 1) / threads;
+
+        // Raw pointers for the dispatch closure: chunk `index` renders a
+        // disjoint voice range into its own scratch buffer, so nothing
+        // aliases across workers.
+        let voices_ptr = SharedPtr(self.voices.as_mut_ptr());
+        let scratch_ptr = SharedPtr(self.thread_buffers.as_mut_ptr());
+
+        let job = move |index: usize| {
+            let start = index * chunk_size;
+            if start >= num_voices {
+                return;
+            }
+            let end = (start + chunk_size).min(num_voices);
+            let chunk =
+                unsafe { std::slice::from_raw_parts_mut(voices_ptr.get().add(start), end - start) };
+            let scratch = unsafe { &mut *scratch_ptr.get().add(index) };
+            for voice in chunk.iter_mut() {
+                if !voice.is_active() {
+                    continue;
+                }
+                for (i, slot) in scratch.iter_mut().enumerate() {
+                    if let Some(&v) = vibrato.get(i) {
+                        for op in &mut voice.operators {
+                            let base_freq = op.oscillator.frequency;
+                            op.oscillator.set_frequency(base_freq * v);
+                        }
+                    }
+                    *slot += voice.tick();
+                }
+            }
+        };
+        pool.run(threads, &job);
+
+        // Block-granular glide: one smoothing step per parallel block
+        let master = self.volume_smooth.next_block(num_samples);
+        for (i, sample) in buffer.iter_mut().enumerate() {
+            let mut sum = 0.0;
+            for scratch in &self.thread_buffers[..threads] {
+                sum += scratch[i];
+            }
+            *sample = sum * master;
+        }
     }
 
     pub fn set_algorithm(&mut self, algo: Dx7Algorithm) {
@@ -1491,6 +1947,7 @@ impl Fm6OpVoiceManager {
 
     pub fn set_master_volume(&mut self, volume: f32) {
         self.master_volume = volume.clamp(0.0, 1.0);
+        self.volume_smooth.set_target(self.master_volume);
     }
 
     // Debug getters
@@ -1638,6 +2095,27 @@ mod tests {
         assert!(voice.is_active());
     }
 
+    #[test]
+    fn test_process_multi_taps_carriers() {
+        let mut mgr = Fm6OpVoiceManager::new(4, 44100.0);
+        mgr.note_on(60, 1.0);
+
+        let mut main = vec![0.0f32; 256];
+        let mut taps: Vec<Vec<f32>> = (0..6).map(|_| vec![0.0f32; 256]).collect();
+        {
+            let mut slices = taps.iter_mut().map(|b| Some(b.as_mut_slice()));
+            let mut op_outs: [Option<&mut [f32]>; 6] =
+                std::array::from_fn(|_| slices.next().flatten());
+            mgr.process_multi(&mut main, &mut op_outs);
+        }
+
+        assert!(main.iter().all(|s| s.is_finite()));
+        assert!(main.iter().any(|s| *s != 0.0));
+        // Default algorithm has OP1 as a carrier; its tap must carry signal
+        assert!(taps[0].iter().any(|s| *s != 0.0));
+        assert!(taps.iter().flatten().all(|s| s.is_finite()));
+    }
+
     #[test]
     fn test_all_algorithms() {
         for algo_idx in 0..8 {
@@ -1651,4 +2129,45 @@ mod tests {
             }
         }
     }
+
+    #[test]
+    fn test_pitch_bend_scales_phase_increments() {
+        let mut mgr = Fm6OpVoiceManager::new(4, 44100.0);
+        mgr.note_on(60, 1.0);
+
+        let base: Vec<f32> = mgr.voices[0]
+            .operators
+            .iter()
+            .map(|op| op.oscillator.phase_increment)
+            .collect();
+
+        // Full wheel up = +pitch_bend_range (2 st) = one whole tone
+        mgr.set_pitch_bend(1.0);
+        let expected = (2.0_f32).powf(2.0 / 12.0);
+        for (op, b) in mgr.voices[0].operators.iter().zip(&base) {
+            let ratio = op.oscillator.phase_increment / b;
+            assert!((ratio - expected).abs() < 1e-4);
+        }
+
+        // Bending again must scale from the base increment, not compound
+        mgr.set_pitch_bend(1.0);
+        for (op, b) in mgr.voices[0].operators.iter().zip(&base) {
+            let ratio = op.oscillator.phase_increment / b;
+            assert!((ratio - expected).abs() < 1e-4);
+        }
+    }
+
+    #[test]
+    fn test_pitch_bend_channel_only_moves_its_voices() {
+        let mut mgr = Fm6OpVoiceManager::new(4, 44100.0);
+        mgr.note_on_with_channel(60, 1.0, 1);
+        mgr.note_on_with_channel(64, 1.0, 2);
+
+        let inc_ch2 = mgr.voices[1].operators[0].oscillator.phase_increment;
+        mgr.set_pitch_bend_channel(1, 1.0);
+
+        assert!(mgr.voices[0].operators[0].oscillator.phase_increment
+            > mgr.voices[0].operators[0].oscillator.frequency / 44100.0);
+        assert_eq!(mgr.voices[1].operators[0].oscillator.phase_increment, inc_ch2);
+    }
 }
@@ -9,12 +9,16 @@
 //! - Polyphonic voice management
 //! - Main synth engine
 
+pub mod drums;
 pub mod envelope;
 pub mod filter;
 pub mod fm;
 pub mod lfo;
 pub mod oscillator;
+pub mod pool;
+pub mod smoother;
 pub mod synth;
+pub mod tables;
 pub mod voice;
 
 // Re-export main types
@@ -27,4 +31,4 @@ pub use fm::{
 pub use lfo::{Lfo, LfoWaveform};
 pub use oscillator::{Oscillator, Waveform, SubWaveform};
 pub use synth::{Synth, SynthParams};
-pub use voice::{Voice, VoiceManager, freq_to_midi, midi_to_freq};
+pub use voice::{StealPolicy, Voice, VoiceManager, freq_to_midi, midi_to_freq};
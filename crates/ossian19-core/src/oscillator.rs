@@ -99,7 +99,7 @@ impl Oscillator {
         let modulated_phase = (self.phase + phase_mod / TWO_PI).rem_euclid(1.0);
 
         let sample = match self.waveform {
-            Waveform::Sine => (modulated_phase * TWO_PI).sin(),
+            Waveform::Sine => crate::tables::sin_norm(modulated_phase),
             Waveform::Saw => {
                 let mut s = 2.0 * modulated_phase - 1.0;
                 s -= self.poly_blep_at(modulated_phase);
@@ -149,7 +149,7 @@ impl Oscillator {
     }
 
     fn sine(&self) -> f32 {
-        (self.phase * TWO_PI).sin()
+        crate::tables::sin_norm(self.phase)
     }
 
     /// Naive saw wave (for reference)
@@ -0,0 +1,245 @@
+//! Persistent worker pool for parallel voice rendering.
+//!
+//! The engines used to spawn scoped threads for every rendered block, which
+//! put a `pthread_create`/join pair (thread-stack allocation, unbounded
+//! scheduler latency) inside the audio callback whenever the pool was
+//! enabled. This pool keeps its workers parked on a condvar between blocks
+//! instead: the render thread publishes one job, wakes the workers, renders
+//! chunk 0 itself and blocks until every participant has checked back in.
+//! Spawning happens only when the pool is created or grown — prepare-time
+//! operations — and dispatching a block does not allocate.
+
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread::JoinHandle;
+
+/// Raw pointer wrapper the dispatch closures use to hand each worker its
+/// disjoint slice of voices/scratch. Safety rests with the closure: chunk
+/// `i` must only dereference regions no other chunk touches.
+pub(crate) struct SharedPtr<T>(pub *mut T);
+
+// Manual impls: the derives would bound `T: Copy`, but only the pointer is
+// copied, never the pointee
+impl<T> Clone for SharedPtr<T> {
+    fn clone(&self) -> Self {
+        *self
+    }
+}
+impl<T> Copy for SharedPtr<T> {}
+
+impl<T> SharedPtr<T> {
+    /// Accessor rather than field access so closures capture the `Sync`
+    /// wrapper itself — 2021-edition disjoint capture would otherwise pull
+    /// in just the raw pointer, which is not `Sync`.
+    pub(crate) fn get(self) -> *mut T {
+        self.0
+    }
+}
+
+unsafe impl<T> Send for SharedPtr<T> {}
+unsafe impl<T> Sync for SharedPtr<T> {}
+
+/// One dispatched job: a lifetime-erased `&(dyn Fn(usize) + Sync)` plus how
+/// many workers take part. The pointer stays valid because `run()` blocks
+/// until `remaining` reaches zero.
+#[derive(Clone, Copy)]
+struct Job {
+    func: *const (dyn Fn(usize) + Sync),
+    participants: usize,
+}
+
+// Only dereferenced while run() keeps the closure alive (see above)
+unsafe impl Send for Job {}
+
+struct State {
+    job: Option<Job>,
+    generation: u64,
+    remaining: usize,
+    shutdown: bool,
+}
+
+struct Shared {
+    state: Mutex<State>,
+    work_cv: Condvar,
+    done_cv: Condvar,
+}
+
+pub struct WorkerPool {
+    shared: Arc<Shared>,
+    workers: Vec<JoinHandle<()>>,
+}
+
+impl WorkerPool {
+    /// Spawn `num_workers` parked worker threads. The dispatching thread
+    /// contributes one more lane, so `concurrency()` is `num_workers + 1`.
+    pub fn new(num_workers: usize) -> Self {
+        let shared = Arc::new(Shared {
+            state: Mutex::new(State {
+                job: None,
+                generation: 0,
+                remaining: 0,
+                shutdown: false,
+            }),
+            work_cv: Condvar::new(),
+            done_cv: Condvar::new(),
+        });
+        let workers = (0..num_workers)
+            .map(|index| {
+                let shared = Arc::clone(&shared);
+                std::thread::Builder::new()
+                    .name(format!("ossian19-worker-{}", index))
+                    .spawn(move || worker_loop(&shared, index))
+                    .expect("failed to spawn render worker")
+            })
+            .collect();
+        Self { shared, workers }
+    }
+
+    /// How many chunks `run()` can execute concurrently.
+    pub fn concurrency(&self) -> usize {
+        self.workers.len() + 1
+    }
+
+    /// Execute `func(index)` for `index` in `0..count`: chunk 0 on the
+    /// calling thread, the rest on the workers. `count` beyond
+    /// `concurrency()` is clamped — size the split to `concurrency()` so no
+    /// chunk goes undispatched. Blocks until every chunk has finished, which
+    /// is what keeps the borrowed closure (and anything it points into)
+    /// valid. Nothing here allocates on the calling thread.
+    pub fn run(&self, count: usize, func: &(dyn Fn(usize) + Sync)) {
+        let participants = count.saturating_sub(1).min(self.workers.len());
+        if participants > 0 {
+            let job = Job {
+                // Erase the closure's lifetime; run() outlives every use
+                func: unsafe {
+                    std::mem::transmute::<
+                        &(dyn Fn(usize) + Sync),
+                        *const (dyn Fn(usize) + Sync),
+                    >(func)
+                },
+                participants,
+            };
+            let mut state = self.shared.state.lock().unwrap();
+            state.job = Some(job);
+            state.generation += 1;
+            state.remaining = participants;
+            drop(state);
+            self.shared.work_cv.notify_all();
+        }
+
+        func(0);
+
+        if participants > 0 {
+            let mut state = self.shared.state.lock().unwrap();
+            while state.remaining > 0 {
+                state = self.shared.done_cv.wait(state).unwrap();
+            }
+        }
+    }
+}
+
+impl Drop for WorkerPool {
+    fn drop(&mut self) {
+        {
+            let mut state = self.shared.state.lock().unwrap();
+            state.shutdown = true;
+        }
+        self.shared.work_cv.notify_all();
+        for worker in self.workers.drain(..) {
+            let _ = worker.join();
+        }
+    }
+}
+
+fn worker_loop(shared: &Shared, index: usize) {
+    let mut last_generation = 0u64;
+    loop {
+        let job = {
+            let mut state = shared.state.lock().unwrap();
+            loop {
+                if state.shutdown {
+                    return;
+                }
+                if state.generation != last_generation {
+                    break;
+                }
+                state = shared.work_cv.wait(state).unwrap();
+            }
+            last_generation = state.generation;
+            state.job
+        };
+
+        // Workers outside the job's split must not touch `remaining`;
+        // run() is only waiting on the participants.
+        let Some(job) = job else { continue };
+        if index >= job.participants {
+            continue;
+        }
+
+        // Chunk 0 belongs to the dispatching thread
+        unsafe { (*job.func)(index + 1) };
+
+        let mut state = shared.state.lock().unwrap();
+        state.remaining -= 1;
+        if state.remaining == 0 {
+            drop(state);
+            shared.done_cv.notify_one();
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+
+    #[test]
+    fn test_runs_every_chunk_exactly_once() {
+        let pool = WorkerPool::new(3);
+        assert_eq!(pool.concurrency(), 4);
+
+        let counts: Vec<AtomicUsize> = (0..4).map(|_| AtomicUsize::new(0)).collect();
+        let job = |index: usize| {
+            counts[index].fetch_add(1, Ordering::SeqCst);
+        };
+        pool.run(4, &job);
+        for count in &counts {
+            assert_eq!(count.load(Ordering::SeqCst), 1);
+        }
+    }
+
+    #[test]
+    fn test_reusable_across_blocks_and_counts() {
+        let pool = WorkerPool::new(3);
+        let total = AtomicUsize::new(0);
+        // Vary the split like a re-split would; every chunk must land once
+        for count in [1usize, 2, 4, 3, 4, 1, 4] {
+            let before = total.load(Ordering::SeqCst);
+            let job = |_: usize| {
+                total.fetch_add(1, Ordering::SeqCst);
+            };
+            pool.run(count, &job);
+            assert_eq!(total.load(Ordering::SeqCst), before + count);
+        }
+    }
+
+    #[test]
+    fn test_disjoint_mutation_through_shared_ptr() {
+        let pool = WorkerPool::new(3);
+        let mut data = vec![0.0f32; 1024];
+        let len = data.len();
+        let chunk_size = len / 4;
+        let ptr = SharedPtr(data.as_mut_ptr());
+        let job = move |index: usize| {
+            let chunk = unsafe {
+                std::slice::from_raw_parts_mut(ptr.get().add(index * chunk_size), chunk_size)
+            };
+            for slot in chunk {
+                *slot += (index + 1) as f32;
+            }
+        };
+        pool.run(4, &job);
+        for (i, value) in data.iter().enumerate() {
+            assert_eq!(*value, (i / chunk_size + 1) as f32);
+        }
+    }
+}
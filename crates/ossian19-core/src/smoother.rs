@@ -0,0 +1,115 @@
+// Parameter smoothing
+//
+// One-pole glide toward a target value, so hosts can push parameter changes
+// at UI rate (e.g. a 30 Hz timer) without zipper noise. This is the engine
+// side of the FFI smoothing contract: setters store a target here and the
+// render path reads the glided value.
+
+/// Default glide window for smoothed engine parameters
+pub const DEFAULT_SMOOTHING_MS: f32 = 5.0;
+
+/// One-pole smoothed parameter value
+#[derive(Debug, Clone)]
+pub struct SmoothedParam {
+    current: f32,
+    target: f32,
+    coef: f32,
+}
+
+impl SmoothedParam {
+    pub fn new(initial: f32) -> Self {
+        Self {
+            current: initial,
+            target: initial,
+            coef: 0.0,
+        }
+    }
+
+    /// Configure the glide window. The coefficient is chosen so a step
+    /// settles to within ~1% of the target after `ms` milliseconds;
+    /// 0 ms disables smoothing (targets snap immediately).
+    pub fn set_time(&mut self, ms: f32, sample_rate: f32) {
+        if ms <= 0.0 || sample_rate <= 0.0 {
+            self.coef = 0.0;
+            self.current = self.target;
+        } else {
+            // exp(ln(0.01) / n) reaches 1% of the remaining distance in n samples
+            self.coef = (-4.605_f32 / (ms * 0.001 * sample_rate)).exp();
+        }
+    }
+
+    pub fn set_target(&mut self, target: f32) {
+        self.target = target;
+        if self.coef == 0.0 {
+            self.current = target;
+        }
+    }
+
+    /// Jump straight to the target (preset loads, prepare callbacks)
+    pub fn snap(&mut self) {
+        self.current = self.target;
+    }
+
+    pub fn target(&self) -> f32 {
+        self.target
+    }
+
+    /// Advance one sample and return the glided value
+    #[inline]
+    pub fn next(&mut self) -> f32 {
+        self.current = self.target + (self.current - self.target) * self.coef;
+        self.current
+    }
+
+    /// Advance `n` samples at once and return the value at the block start.
+    /// Used by block-granular render paths (parallel rendering) where one
+    /// value must hold for the whole chunk.
+    pub fn next_block(&mut self, n: usize) -> f32 {
+        let value = self.current;
+        self.current = self.target + (self.current - self.target) * self.coef.powi(n as i32);
+        value
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_converges_within_window() {
+        let mut p = SmoothedParam::new(0.0);
+        p.set_time(5.0, 44100.0);
+        p.set_target(1.0);
+        let n = (0.005 * 44100.0) as usize;
+        let mut last = 0.0;
+        for _ in 0..n {
+            let v = p.next();
+            assert!(v >= last, "glide must be monotonic");
+            last = v;
+        }
+        assert!((last - 1.0).abs() < 0.02, "not settled: {}", last);
+    }
+
+    #[test]
+    fn test_zero_ms_snaps() {
+        let mut p = SmoothedParam::new(0.0);
+        p.set_time(0.0, 44100.0);
+        p.set_target(1.0);
+        assert_eq!(p.next(), 1.0);
+    }
+
+    #[test]
+    fn test_next_block_matches_per_sample_endpoint() {
+        let mut a = SmoothedParam::new(0.0);
+        let mut b = SmoothedParam::new(0.0);
+        a.set_time(5.0, 44100.0);
+        b.set_time(5.0, 44100.0);
+        a.set_target(1.0);
+        b.set_target(1.0);
+        for _ in 0..128 {
+            a.next();
+        }
+        b.next_block(128);
+        assert!((a.current - b.current).abs() < 1e-5);
+    }
+}
@@ -1,8 +1,10 @@
 use serde::{Deserialize, Serialize};
 
 use crate::filter::{FilterType, FilterSlope};
+use crate::pool::{SharedPtr, WorkerPool};
+use crate::smoother::{SmoothedParam, DEFAULT_SMOOTHING_MS};
 use crate::oscillator::{Waveform, SubWaveform};
-use crate::voice::VoiceManager;
+use crate::voice::{StealPolicy, VoiceManager};
 
 /// Main synthesizer parameters (serializable for presets)
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -33,6 +35,14 @@ pub struct SynthParams {
     pub fm_amount: f32,  // 0 = off (subtractive), 1 = full FM
     pub fm_ratio: f32,   // Modulator:Carrier frequency ratio
 
+    // Unison / supersaw (serde defaults keep old presets loading)
+    #[serde(default = "default_unison_voices")]
+    pub unison_voices: usize, // 1 = off, up to voice::MAX_UNISON
+    #[serde(default)]
+    pub unison_detune: f32,   // cents, symmetric spread
+    #[serde(default)]
+    pub unison_spread: f32,   // side-copy level, 0-1
+
     // High-pass filter (Juno-6 style, before LPF)
     pub hpf_cutoff: f32, // 20-2000 Hz, non-resonant
 
@@ -78,6 +88,9 @@ impl Default for SynthParams {
             noise_level: 0.0,  // Off by default
             fm_amount: 0.0,    // FM off by default (subtractive mode)
             fm_ratio: 2.0,     // Classic 2:1 ratio
+            unison_voices: 1,  // Unison off by default
+            unison_detune: 25.0,
+            unison_spread: 0.7,
             // HPF (Juno-6 style)
             hpf_cutoff: 20.0,  // Essentially off (lowest)
             filter_type: FilterType::LowPass,
@@ -98,11 +111,33 @@ impl Default for SynthParams {
     }
 }
 
+fn default_unison_voices() -> usize {
+    1
+}
+
+/// Minimum block size for the parallel render path; smaller blocks are not
+/// worth the fork/join overhead
+pub const PARALLEL_BLOCK_MIN: usize = 256;
+
 /// Main synthesizer engine
 pub struct Synth {
     voice_manager: VoiceManager,
     params: SynthParams,
     sample_rate: f32,
+    /// Worker threads for voice rendering (1 = single-threaded)
+    num_threads: usize,
+    /// Per-thread mix buffers for the parallel render path
+    thread_buffers: Vec<Vec<f32>>,
+    /// Persistent workers for the parallel path (None until a multi-thread
+    /// split is requested); parked between blocks, never spawned per block
+    worker_pool: Option<WorkerPool>,
+    /// Faster-than-realtime bounce mode (relaxes the parallel block gate)
+    offline: bool,
+    /// Smoothed copies of the global continuous parameters, so hosts can
+    /// push setter calls at UI rate without zipper noise
+    cutoff_smooth: SmoothedParam,
+    volume_smooth: SmoothedParam,
+    smoothing_ms: f32,
 }
 
 impl Synth {
@@ -111,7 +146,16 @@ impl Synth {
             voice_manager: VoiceManager::new(num_voices, sample_rate),
             params: SynthParams::default(),
             sample_rate,
+            num_threads: 1,
+            thread_buffers: Vec::new(),
+            worker_pool: None,
+            offline: false,
+            cutoff_smooth: SmoothedParam::new(SynthParams::default().filter_cutoff),
+            volume_smooth: SmoothedParam::new(SynthParams::default().master_volume),
+            smoothing_ms: DEFAULT_SMOOTHING_MS,
         };
+        synth.cutoff_smooth.set_time(synth.smoothing_ms, sample_rate);
+        synth.volume_smooth.set_time(synth.smoothing_ms, sample_rate);
         synth.apply_params();
         synth
     }
@@ -119,6 +163,23 @@ impl Synth {
     pub fn set_sample_rate(&mut self, sample_rate: f32) {
         self.sample_rate = sample_rate;
         self.voice_manager.set_sample_rate(sample_rate);
+        self.cutoff_smooth.set_time(self.smoothing_ms, sample_rate);
+        self.volume_smooth.set_time(self.smoothing_ms, sample_rate);
+    }
+
+    /// Glide window for the smoothed global parameters (filter cutoff,
+    /// master volume). 0 disables smoothing; values snap immediately.
+    pub fn set_smoothing_ms(&mut self, ms: f32) {
+        self.smoothing_ms = ms.clamp(0.0, 100.0);
+        self.cutoff_smooth.set_time(self.smoothing_ms, self.sample_rate);
+        self.volume_smooth.set_time(self.smoothing_ms, self.sample_rate);
+    }
+
+    /// Jump the smoothed parameters straight to their targets. Preset
+    /// applies call this so a patch change doesn't glide from the old one.
+    pub fn snap_smoothed(&mut self) {
+        self.cutoff_smooth.snap();
+        self.volume_smooth.snap();
     }
 
     /// Get current parameters
@@ -135,6 +196,12 @@ impl Synth {
     pub fn set_params(&mut self, params: SynthParams) {
         self.params = params;
         self.apply_params();
+        // A preset load is a deliberate jump, not automation: snap the
+        // smoothed parameters instead of gliding from the old patch
+        self.cutoff_smooth.set_target(self.params.filter_cutoff);
+        self.volume_smooth.set_target(self.params.master_volume);
+        self.cutoff_smooth.snap();
+        self.volume_smooth.snap();
     }
 
     /// Apply current params to all voices
@@ -148,6 +215,9 @@ impl Synth {
         self.voice_manager.set_noise_level(self.params.noise_level);
         self.voice_manager.set_fm_amount(self.params.fm_amount);
         self.voice_manager.set_fm_ratio(self.params.fm_ratio);
+        self.voice_manager.set_unison_voices(self.params.unison_voices);
+        self.voice_manager.set_unison_detune(self.params.unison_detune);
+        self.voice_manager.set_unison_spread(self.params.unison_spread);
         self.voice_manager.set_filter_resonance(self.params.filter_resonance);
         self.voice_manager.set_filter_slope(self.params.filter_slope);
         self.voice_manager.set_filter_env_amount(self.params.filter_env_amount);
@@ -171,6 +241,12 @@ impl Synth {
         self.voice_manager.note_on(note, vel);
     }
 
+    /// Handle MIDI note on with its source channel (for per-channel bend)
+    pub fn note_on_with_channel(&mut self, note: u8, velocity: u8, channel: u8) {
+        let vel = velocity as f32 / 127.0;
+        self.voice_manager.note_on_with_channel(note, vel, channel);
+    }
+
     /// Handle MIDI note off
     pub fn note_off(&mut self, note: u8) {
         self.voice_manager.note_off(note);
@@ -184,10 +260,12 @@ impl Synth {
             1 => {
                 // Mod wheel -> filter cutoff
                 self.params.filter_cutoff = 100.0 + normalized * 19900.0;
+                self.cutoff_smooth.set_target(self.params.filter_cutoff);
             }
             74 => {
                 // Brightness -> filter cutoff
                 self.params.filter_cutoff = 100.0 + normalized * 19900.0;
+                self.cutoff_smooth.set_target(self.params.filter_cutoff);
             }
             71 => {
                 // Resonance
@@ -229,9 +307,25 @@ impl Synth {
         self.voice_manager.active_voice_count()
     }
 
+    /// Fade out up to `count` of the quietest release-phase voices (CPU
+    /// budgeter; see VoiceManager::shed_quietest_release)
+    pub fn shed_quietest_release(&mut self, count: usize) -> usize {
+        self.voice_manager.shed_quietest_release(count)
+    }
+
+    /// Cap how many voices may sound at once
+    pub fn set_max_polyphony(&mut self, max: usize) {
+        self.voice_manager.set_max_polyphony(max);
+    }
+
+    /// Choose which voice gets stolen when the cap is reached
+    pub fn set_steal_policy(&mut self, policy: StealPolicy) {
+        self.voice_manager.set_steal_policy(policy);
+    }
+
     /// Process a single sample
     pub fn tick(&mut self) -> f32 {
-        let cutoff = self.params.filter_cutoff;
+        let cutoff = self.cutoff_smooth.next();
         let mut output = 0.0;
 
         for voice in self.voice_manager.voices_mut() {
@@ -240,11 +334,15 @@ impl Synth {
             }
         }
 
-        output * self.params.master_volume
+        output * self.volume_smooth.next()
     }
 
     /// Process a buffer of samples (more efficient)
     pub fn process(&mut self, buffer: &mut [f32]) {
+        if self.use_parallel(buffer.len()) {
+            self.process_parallel(buffer);
+            return;
+        }
         for sample in buffer.iter_mut() {
             *sample = self.tick();
         }
@@ -252,6 +350,12 @@ impl Synth {
 
     /// Process stereo buffer
     pub fn process_stereo(&mut self, left: &mut [f32], right: &mut [f32]) {
+        if self.use_parallel(left.len().min(right.len())) {
+            let n = left.len().min(right.len());
+            self.process_parallel(&mut left[..n]);
+            right[..n].copy_from_slice(&left[..n]);
+            return;
+        }
         for (l, r) in left.iter_mut().zip(right.iter_mut()) {
             let sample = self.tick();
             *l = sample;
@@ -259,6 +363,121 @@ impl Synth {
         }
     }
 
+    /// Opt into worker-pool rendering. Voices are partitioned across
+    /// `num_threads` for blocks of at least PARALLEL_BLOCK_MIN samples;
+    /// 0 or 1 restores the single-threaded path. The workers are persistent
+    /// — parked on a condvar between blocks, never spawned per block — but
+    /// growing the pool spawns OS threads, so call this with the largest
+    /// split you intend to use from a prepare callback; shrinking (and
+    /// re-growing within that ceiling) is render-safe.
+    pub fn set_num_threads(&mut self, num_threads: usize) {
+        self.num_threads = num_threads.clamp(1, 16);
+        // Grow only: prewarm() may have reserved scratch for a larger
+        // split, and process_parallel() slices to num_threads anyway.
+        if self.thread_buffers.len() < self.num_threads {
+            self.thread_buffers.resize_with(self.num_threads, Vec::new);
+        }
+        let workers_needed = self.num_threads - 1;
+        let workers_have = self.worker_pool.as_ref().map_or(0, |p| p.concurrency() - 1);
+        if workers_needed > workers_have {
+            self.worker_pool = Some(WorkerPool::new(workers_needed));
+        }
+    }
+
+    /// Preallocate every per-thread scratch buffer for blocks up to
+    /// `max_block` samples, covering all thread counts set_num_threads()
+    /// can later select, so neither the first parallel block nor a
+    /// mid-session re-split allocates on the audio thread. Voices are
+    /// fully allocated at construction. Call from a prepare callback.
+    pub fn prewarm(&mut self, max_block: usize) {
+        if self.thread_buffers.len() < 16 {
+            self.thread_buffers.resize_with(16, Vec::new);
+        }
+        for scratch in &mut self.thread_buffers {
+            scratch.clear();
+            scratch.reserve(max_block);
+        }
+    }
+
+    /// Mark the engine as rendering faster than realtime (host bounce).
+    /// Offline we only care about throughput, not worst-case callback time,
+    /// so the worker pool is allowed to engage on smaller blocks.
+    pub fn set_offline(&mut self, offline: bool) {
+        self.offline = offline;
+    }
+
+    fn use_parallel(&self, num_samples: usize) -> bool {
+        let min_block = if self.offline {
+            PARALLEL_BLOCK_MIN / 4
+        } else {
+            PARALLEL_BLOCK_MIN
+        };
+        self.num_threads > 1 && num_samples >= min_block
+    }
+
+    /// Render a block with voices partitioned across the persistent worker
+    /// pool, summing the per-thread buffers into `buffer`. Semantics match
+    /// the serial path: each voice only touches its own state, so chunks are
+    /// independent. Nothing here spawns or allocates once prewarm() has run.
+    fn process_parallel(&mut self, buffer: &mut [f32]) {
+        let num_samples = buffer.len();
+        if self.worker_pool.is_none() {
+            for sample in buffer.iter_mut() {
+                *sample = self.tick();
+            }
+            return;
+        }
+        let pool = self.worker_pool.as_ref().unwrap();
+        let threads = self.num_threads.min(pool.concurrency());
+        for scratch in &mut self.thread_buffers[..threads] {
+            scratch.clear();
+            scratch.resize(num_samples, 0.0);
+        }
+
+        // Block-granular smoothing: one glide step per chunk. Parallel
+        // rendering only engages on large blocks, where per-sample glide
+        // would force the cutoff through every voice chunk anyway.
+        let cutoff = self.cutoff_smooth.next_block(num_samples);
+        let voices = self.voice_manager.voices_mut();
+        let num_voices = voices.len();
+        let chunk_size = (num_voices + threads - 1) / threads;
+
+        // Raw pointers for the dispatch closure: chunk `index` renders a
+        // disjoint voice range into its own scratch buffer, so nothing
+        // aliases across workers.
+        let voices_ptr = SharedPtr(voices.as_mut_ptr());
+        let scratch_ptr = SharedPtr(self.thread_buffers.as_mut_ptr());
+
+        let job = move |index: usize| {
+            let start = index * chunk_size;
+            if start >= num_voices {
+                return;
+            }
+            let end = (start + chunk_size).min(num_voices);
+            let chunk =
+                unsafe { std::slice::from_raw_parts_mut(voices_ptr.get().add(start), end - start) };
+            let scratch = unsafe { &mut *scratch_ptr.get().add(index) };
+            for voice in chunk.iter_mut() {
+                if !voice.active {
+                    continue;
+                }
+                for slot in scratch.iter_mut() {
+                    *slot += voice.tick(cutoff);
+                }
+            }
+        };
+        pool.run(threads, &job);
+
+        let master = self.volume_smooth.next_block(num_samples);
+        for (i, sample) in buffer.iter_mut().enumerate() {
+            let mut sum = 0.0;
+            for scratch in &self.thread_buffers[..threads] {
+                sum += scratch[i];
+            }
+            *sample = sum * master;
+        }
+    }
+
     // Parameter setters for real-time control
 
     pub fn set_osc1_waveform(&mut self, waveform: Waveform) {
@@ -306,6 +525,23 @@ impl Synth {
         self.voice_manager.set_fm_ratio(ratio);
     }
 
+    // === Unison / supersaw ===
+
+    pub fn set_unison_voices(&mut self, count: usize) {
+        self.params.unison_voices = count.clamp(1, crate::voice::MAX_UNISON);
+        self.voice_manager.set_unison_voices(count);
+    }
+
+    pub fn set_unison_detune(&mut self, cents: f32) {
+        self.params.unison_detune = cents.clamp(0.0, 100.0);
+        self.voice_manager.set_unison_detune(cents);
+    }
+
+    pub fn set_unison_spread(&mut self, spread: f32) {
+        self.params.unison_spread = spread.clamp(0.0, 1.0);
+        self.voice_manager.set_unison_spread(spread);
+    }
+
     // === Juno-6 style PWM ===
 
     pub fn set_pulse_width(&mut self, width: f32) {
@@ -344,6 +580,7 @@ impl Synth {
 
     pub fn set_filter_cutoff(&mut self, cutoff: f32) {
         self.params.filter_cutoff = cutoff.clamp(20.0, 20000.0);
+        self.cutoff_smooth.set_target(self.params.filter_cutoff);
     }
 
     pub fn set_filter_resonance(&mut self, resonance: f32) {
@@ -379,6 +616,7 @@ impl Synth {
 
     pub fn set_master_volume(&mut self, volume: f32) {
         self.params.master_volume = volume.clamp(0.0, 1.0);
+        self.volume_smooth.set_target(self.params.master_volume);
     }
 
     /// Set pitch bend (-1 to 1, where 1 = +pitch_bend_range semitones)
@@ -386,6 +624,11 @@ impl Synth {
         self.voice_manager.set_pitch_bend(value);
     }
 
+    /// Per-channel (MPE) pitch bend: only voices started on `channel` move
+    pub fn set_pitch_bend_channel(&mut self, channel: u8, value: f32) {
+        self.voice_manager.set_pitch_bend_channel(channel, value);
+    }
+
     /// Set pitch bend range in semitones (typically 2, 12, or 24)
     pub fn set_pitch_bend_range(&mut self, semitones: f32) {
         self.voice_manager.set_pitch_bend_range(semitones);
@@ -396,6 +639,17 @@ impl Synth {
 mod tests {
     use super::*;
 
+    #[test]
+    fn test_prewarm_survives_thread_resplit() {
+        let mut synth = Synth::new(44100.0, 8);
+        synth.prewarm(512);
+        synth.set_num_threads(4);
+        assert!(synth.thread_buffers.iter().all(|b| b.capacity() >= 512));
+        // Growing the split later must not discard the reserved scratch
+        synth.set_num_threads(8);
+        assert!(synth.thread_buffers[..8].iter().all(|b| b.capacity() >= 512));
+    }
+
     #[test]
     fn test_synth_basic() {
         let mut synth = Synth::new(44100.0, 8);
@@ -420,6 +674,30 @@ mod tests {
         assert!(buffer.iter().any(|&s| s != 0.0));
     }
 
+    #[test]
+    fn test_parallel_render_matches_serial() {
+        let make = || {
+            let mut synth = Synth::new(44100.0, 8);
+            synth.note_on(60, 100);
+            synth.note_on(64, 100);
+            synth.note_on(67, 100);
+            synth
+        };
+
+        let mut serial = make();
+        let mut parallel = make();
+        parallel.set_num_threads(4);
+
+        let mut serial_buf = vec![0.0; 512];
+        let mut parallel_buf = vec![0.0; 512];
+        serial.process(&mut serial_buf);
+        parallel.process(&mut parallel_buf);
+
+        for (a, b) in serial_buf.iter().zip(parallel_buf.iter()) {
+            assert!((a - b).abs() < 1e-6);
+        }
+    }
+
     #[test]
     fn test_preset_serialization() {
         let params = SynthParams::default();
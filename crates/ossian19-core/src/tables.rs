@@ -0,0 +1,84 @@
+//! Process-wide read-only lookup tables shared by every engine instance.
+//!
+//! The tables live in statics, so 40 plugin instances in one session share
+//! the same hot cache lines instead of each warming up (and keeping) private
+//! copies. Hosts can pay the one-time build cost at session load by calling
+//! `ossian19_tables_init()` through the FFI; otherwise the first render that
+//! needs a table builds it lazily.
+
+use std::sync::OnceLock;
+
+/// Sine table resolution. With linear interpolation the worst-case error is
+/// (pi / SIZE)^2 / 8 ~ 7e-8 — below f32 rounding noise for audio, and far
+/// cheaper than libm sin() in the per-operator FM inner loop.
+pub const SINE_TABLE_SIZE: usize = 4096;
+
+static SINE_TABLE: OnceLock<Box<[f32]>> = OnceLock::new();
+
+/// Build all shared tables now. Idempotent and thread-safe; exposed over the
+/// FFI so hosts can front-load the work before the first audio callback.
+pub fn init() {
+    let _ = sine_table();
+}
+
+fn sine_table() -> &'static [f32] {
+    SINE_TABLE.get_or_init(|| {
+        // One guard point past the end so interpolation never wraps
+        (0..=SINE_TABLE_SIZE)
+            .map(|i| (i as f32 / SINE_TABLE_SIZE as f32 * std::f32::consts::TAU).sin())
+            .collect()
+    })
+}
+
+/// Interpolated sine for a normalized phase (1.0 per cycle). The phase may
+/// be any finite value; it is wrapped into [0, 1).
+#[inline]
+pub fn sin_norm(phase: f32) -> f32 {
+    let table = sine_table();
+    let mut wrapped = phase - phase.floor();
+    // For tiny negative phases (within one f32 ulp below an integer) the
+    // subtraction rounds up to exactly 1.0, which would index one past the
+    // guard point. Fold it back to the start of the cycle.
+    if wrapped >= 1.0 {
+        wrapped = 0.0;
+    }
+    let pos = wrapped * SINE_TABLE_SIZE as f32;
+    let idx = pos as usize;
+    let frac = pos - idx as f32;
+    table[idx] + (table[idx + 1] - table[idx]) * frac
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_sin_norm_matches_libm() {
+        for i in -1000..1000 {
+            let phase = i as f32 * 0.0137;
+            let expected = (phase * std::f32::consts::TAU).sin();
+            assert!(
+                (sin_norm(phase) - expected).abs() < 1e-4,
+                "phase {} diverged",
+                phase
+            );
+        }
+    }
+
+    #[test]
+    fn test_sin_norm_tiny_negative_phase() {
+        // phase - phase.floor() rounds up to exactly 1.0 here; must not
+        // index past the guard point (or panic across the FFI boundary)
+        for phase in [-1e-9f32, -1e-7, -f32::EPSILON, 2.0 - 1e-7] {
+            let value = sin_norm(phase);
+            assert!(value.abs() < 1e-4, "phase {} gave {}", phase, value);
+        }
+    }
+
+    #[test]
+    fn test_init_is_idempotent() {
+        init();
+        init();
+        assert_eq!(sin_norm(0.25), 1.0);
+    }
+}
@@ -1,4 +1,4 @@
-use crate::envelope::Envelope;
+use crate::envelope::{Envelope, EnvelopeStage};
 use crate::filter::LadderFilter;
 use crate::oscillator::{Oscillator, Waveform};
 
@@ -29,6 +29,9 @@ impl Default for NoiseGen {
     }
 }
 
+/// Maximum unison copies per voice (classic supersaw count)
+pub const MAX_UNISON: usize = 7;
+
 /// A single synth voice (monophonic unit)
 #[derive(Debug, Clone)]
 pub struct Voice {
@@ -46,6 +49,12 @@ pub struct Voice {
     pub velocity: f32,
     /// Is this voice currently active?
     pub active: bool,
+    /// MIDI channel the note-on arrived on (0-15), so per-channel (MPE)
+    /// pitch bend can find its voices
+    pub channel: u8,
+    /// Monotonic note counter value from the manager, used to find the
+    /// oldest voice when stealing
+    pub start_order: u64,
 
     // Filter envelope modulation amount
     pub filter_env_amount: f32,
@@ -58,6 +67,15 @@ pub struct Voice {
     // FM synthesis parameters
     pub fm_amount: f32,    // 0.0 = no FM, 1.0 = full FM modulation
     pub fm_ratio: f32,     // Modulator frequency ratio (1.0 = same as carrier)
+
+    // Unison (supersaw): detuned copies of osc1 summed before the voice's
+    // single filter/envelope pass, so 7-voice unison costs one filter chain
+    pub unison_voices: usize,  // 1 = off
+    pub unison_detune: f32,    // cents, symmetric spread across copies
+    pub unison_mix: f32,       // side-copy level relative to the centre
+    unison_phases: [f32; MAX_UNISON],
+    unison_increments: [f32; MAX_UNISON],
+    sample_rate: f32,
 }
 
 impl Voice {
@@ -76,6 +94,8 @@ impl Voice {
             note: 0,
             velocity: 0.0,
             active: false,
+            channel: 0,
+            start_order: 0,
             filter_env_amount: 0.5,
             osc1_level: 1.0,
             osc2_level: 0.0,  // Off by default
@@ -83,10 +103,17 @@ impl Voice {
             noise_level: 0.0, // Off by default
             fm_amount: 0.0,   // No FM by default
             fm_ratio: 2.0,    // Classic 2:1 ratio
+            unison_voices: 1,
+            unison_detune: 25.0,
+            unison_mix: 0.7,
+            unison_phases: [0.0; MAX_UNISON],
+            unison_increments: [0.0; MAX_UNISON],
+            sample_rate,
         }
     }
 
     pub fn set_sample_rate(&mut self, sample_rate: f32) {
+        self.sample_rate = sample_rate;
         self.osc1.set_sample_rate(sample_rate);
         self.osc2.set_sample_rate(sample_rate);
         self.sub_osc.set_sample_rate(sample_rate);
@@ -122,11 +149,63 @@ impl Voice {
         self.osc2.reset();
         self.sub_osc.reset();
 
+        self.refresh_unison(freq);
+        self.stagger_unison_phases();
+
         // Trigger envelopes
         self.amp_env.trigger();
         self.filter_env.trigger();
     }
 
+    /// Recompute the unison copies' phase increments for the given centre
+    /// frequency. Copies fan out symmetrically across +/- unison_detune
+    /// cents; start phases are staggered so the stack never begins coherent.
+    pub fn refresh_unison(&mut self, freq: f32) {
+        if self.unison_voices < 2 || self.sample_rate <= 0.0 {
+            return;
+        }
+        let n = self.unison_voices.min(MAX_UNISON);
+        let centre = (n - 1) as f32 * 0.5;
+        for i in 0..n {
+            let cents = (i as f32 - centre) / centre * self.unison_detune;
+            let detuned = freq * (2.0_f32).powf(cents / 1200.0);
+            self.unison_increments[i] = detuned / self.sample_rate;
+        }
+    }
+
+    /// Spread the copies' start phases across the cycle. Done at note-on
+    /// only, so automating detune mid-note never resets the stack.
+    fn stagger_unison_phases(&mut self) {
+        let n = self.unison_voices.min(MAX_UNISON);
+        for i in 0..n {
+            self.unison_phases[i] = i as f32 / n as f32;
+        }
+    }
+
+    /// Sum the unison stack in one batch pass. The centre slot is the real
+    /// osc1 (keeps PolyBLEP and PWM); side copies are naive saws over plain
+    /// phase accumulators — a branch-free loop over two small arrays that
+    /// the compiler vectorizes, and the heavy mutual detune masks the side
+    /// copies' aliasing (the classic supersaw recipe). Everything downstream
+    /// — filter, envelopes — runs once for the whole stack.
+    fn tick_unison(&mut self) -> f32 {
+        let n = self.unison_voices.min(MAX_UNISON);
+        let centre_idx = (n - 1) / 2;
+        let centre_naive = 2.0 * self.unison_phases[centre_idx] - 1.0;
+
+        let mut sides = 0.0;
+        for i in 0..n {
+            sides += 2.0 * self.unison_phases[i] - 1.0;
+            let next = self.unison_phases[i] + self.unison_increments[i];
+            self.unison_phases[i] = next - next.floor();
+        }
+
+        // The centre slot's naive saw is replaced by the real osc1 output
+        let centre = self.osc1.tick();
+        (centre + (sides - centre_naive) * self.unison_mix)
+            / (1.0 + self.unison_mix * (n - 1) as f32)
+    }
+
     /// Release a note
     pub fn note_off(&mut self) {
         self.amp_env.release();
@@ -166,8 +245,13 @@ impl Voice {
             // (like a "wet" signal for the modulator)
             osc2_out = mod_signal * self.osc2_level * (1.0 - self.fm_amount * 0.5);
         } else {
-            // Normal subtractive mode: oscillators are mixed additively
-            osc1_out = self.osc1.tick() * self.osc1_level;
+            // Normal subtractive mode: oscillators are mixed additively.
+            // Unison fattens osc1 only; osc2/sub/noise stay single.
+            osc1_out = if self.unison_voices > 1 {
+                self.tick_unison() * self.osc1_level
+            } else {
+                self.osc1.tick() * self.osc1_level
+            };
             osc2_out = self.osc2.tick() * self.osc2_level;
         }
 
@@ -227,14 +311,34 @@ pub fn freq_to_midi(freq: f32) -> u8 {
     (12.0 * (freq / 440.0).log2() + 69.0).round() as u8
 }
 
+/// Which voice to sacrifice when a note arrives and every voice is busy
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum StealPolicy {
+    /// Steal the voice that started longest ago
+    #[default]
+    Oldest,
+    /// Steal the voice with the lowest audible level (envelope x velocity)
+    Quietest,
+    /// Steal a voice already playing the same note, falling back to oldest
+    SameNote,
+}
+
 /// Polyphonic voice manager
 pub struct VoiceManager {
     voices: Vec<Voice>,
     sample_rate: f32,
-    /// Pitch bend in semitones (-range to +range)
-    pitch_bend: f32,
+    /// Pitch bend per MIDI channel, in semitones (-range to +range).
+    /// Single-channel streams land everything in one slot, which behaves
+    /// like a global bend; MPE streams get per-note bend via their member
+    /// channels.
+    pitch_bend: [f32; 16],
     /// Pitch bend range in semitones (default: 2)
     pitch_bend_range: f32,
+    /// How many of the allocated voices may sound at once
+    max_polyphony: usize,
+    steal_policy: StealPolicy,
+    /// Incremented on every note-on; stamps voices for oldest-first stealing
+    note_counter: u64,
 }
 
 impl VoiceManager {
@@ -243,11 +347,34 @@ impl VoiceManager {
         Self {
             voices,
             sample_rate,
-            pitch_bend: 0.0,
+            pitch_bend: [0.0; 16],
             pitch_bend_range: 2.0, // ±2 semitones default
+            max_polyphony: num_voices,
+            steal_policy: StealPolicy::default(),
+            note_counter: 0,
         }
     }
 
+    /// Cap how many voices may sound at once (clamped to the allocated pool).
+    /// Voices above the cap are silenced immediately. No allocation happens
+    /// here, so this is safe to call from the audio thread.
+    pub fn set_max_polyphony(&mut self, max: usize) {
+        self.max_polyphony = max.clamp(1, self.voices.len());
+        for voice in &mut self.voices[self.max_polyphony..] {
+            if voice.active {
+                voice.reset();
+            }
+        }
+    }
+
+    pub fn max_polyphony(&self) -> usize {
+        self.max_polyphony
+    }
+
+    pub fn set_steal_policy(&mut self, policy: StealPolicy) {
+        self.steal_policy = policy;
+    }
+
     pub fn set_sample_rate(&mut self, sample_rate: f32) {
         self.sample_rate = sample_rate;
         for voice in &mut self.voices {
@@ -255,32 +382,70 @@ impl VoiceManager {
         }
     }
 
-    /// Find a free voice or steal the oldest one
-    fn allocate_voice(&mut self) -> Option<&mut Voice> {
-        // First, try to find an inactive voice by index
-        let inactive_idx = self.voices.iter().position(|v| !v.active);
+    /// Find a free voice within the polyphony cap, or steal one per the
+    /// configured policy
+    fn allocate_voice(&mut self, note: u8) -> Option<&mut Voice> {
+        let limit = self.max_polyphony.min(self.voices.len());
+        let pool = &self.voices[..limit];
 
-        if let Some(idx) = inactive_idx {
+        // First, try to find an inactive voice by index
+        if let Some(idx) = pool.iter().position(|v| !v.active) {
             return self.voices.get_mut(idx);
         }
 
-        // Voice stealing: find the voice in release stage with lowest amplitude
-        // For simplicity, just take the first voice (round-robin stealing)
-        self.voices.first_mut()
+        fn oldest(pool: &[Voice]) -> usize {
+            pool.iter()
+                .enumerate()
+                .min_by_key(|(_, v)| v.start_order)
+                .map(|(i, _)| i)
+                .unwrap_or(0)
+        }
+
+        let idx = match self.steal_policy {
+            StealPolicy::Oldest => oldest(pool),
+            StealPolicy::Quietest => pool
+                .iter()
+                .enumerate()
+                .min_by(|(_, a), (_, b)| {
+                    let level_a = a.amp_env.level() * a.velocity;
+                    let level_b = b.amp_env.level() * b.velocity;
+                    level_a.partial_cmp(&level_b).unwrap_or(std::cmp::Ordering::Equal)
+                })
+                .map(|(i, _)| i)
+                .unwrap_or(0),
+            StealPolicy::SameNote => pool
+                .iter()
+                .position(|v| v.note == note)
+                .unwrap_or_else(|| oldest(pool)),
+        };
+        self.voices.get_mut(idx)
     }
 
     /// Start a new note
     pub fn note_on(&mut self, note: u8, velocity: f32) {
-        let bend_mult = self.pitch_bend_multiplier();
+        self.note_on_with_channel(note, velocity, 0);
+    }
+
+    /// Start a new note, tagging the voice with its source MIDI channel so
+    /// per-channel (MPE) pitch bend can find it later
+    pub fn note_on_with_channel(&mut self, note: u8, velocity: f32, channel: u8) {
+        let channel = channel & 15;
+        let bend_mult = self.bend_multiplier(channel);
+        self.note_counter += 1;
+        let serial = self.note_counter;
 
         // Check if this note is already playing, if so, retrigger
         if let Some(voice) = self.voices.iter_mut().find(|v| v.active && v.note == note) {
+            voice.start_order = serial;
+            voice.channel = channel;
             voice.note_on_with_bend(note, velocity, bend_mult);
             return;
         }
 
         // Allocate a new voice
-        if let Some(voice) = self.allocate_voice() {
+        if let Some(voice) = self.allocate_voice(note) {
+            voice.start_order = serial;
+            voice.channel = channel;
             voice.note_on_with_bend(note, velocity, bend_mult);
         }
     }
@@ -308,6 +473,39 @@ impl VoiceManager {
         }
     }
 
+    /// CPU budgeter escape valve: fade out up to `count` of the quietest
+    /// voices that are already in their release phase by collapsing their
+    /// remaining release to ~20 ms (Envelope::shed). Held notes are never
+    /// touched, so under deadline pressure long tails go first. Returns
+    /// how many voices were shed.
+    pub fn shed_quietest_release(&mut self, count: usize) -> usize {
+        let mut shed = 0;
+        while shed < count {
+            let mut quietest: Option<usize> = None;
+            let mut quietest_level = f32::MAX;
+            for (i, voice) in self.voices.iter().enumerate() {
+                if voice.active
+                    && voice.amp_env.stage() == EnvelopeStage::Release
+                    && !voice.amp_env.is_shedding()
+                {
+                    let level = voice.amp_env.level() * voice.velocity;
+                    if level < quietest_level {
+                        quietest_level = level;
+                        quietest = Some(i);
+                    }
+                }
+            }
+            match quietest {
+                Some(i) => {
+                    self.voices[i].amp_env.shed();
+                    shed += 1;
+                }
+                None => break,
+            }
+        }
+        shed
+    }
+
     /// Get number of currently active voices
     pub fn active_voice_count(&self) -> usize {
         self.voices.iter().filter(|v| v.active).count()
@@ -350,6 +548,38 @@ impl VoiceManager {
         }
     }
 
+    pub fn set_unison_voices(&mut self, count: usize) {
+        let count = count.clamp(1, MAX_UNISON);
+        let bends = self.pitch_bend;
+        for voice in &mut self.voices {
+            voice.unison_voices = count;
+            // Re-fan sounding voices so the new copies start with sensible
+            // increments instead of sitting at DC until the next note-on
+            if voice.active {
+                let bend = (2.0_f32).powf(bends[(voice.channel & 15) as usize] / 12.0);
+                voice.refresh_unison(midi_to_freq(voice.note) * bend);
+            }
+        }
+    }
+
+    pub fn set_unison_detune(&mut self, cents: f32) {
+        let cents = cents.clamp(0.0, 100.0);
+        let bends = self.pitch_bend;
+        for voice in &mut self.voices {
+            voice.unison_detune = cents;
+            if voice.active {
+                let bend = (2.0_f32).powf(bends[(voice.channel & 15) as usize] / 12.0);
+                voice.refresh_unison(midi_to_freq(voice.note) * bend);
+            }
+        }
+    }
+
+    pub fn set_unison_spread(&mut self, spread: f32) {
+        for voice in &mut self.voices {
+            voice.unison_mix = spread.clamp(0.0, 1.0);
+        }
+    }
+
     pub fn set_noise_level(&mut self, level: f32) {
         for voice in &mut self.voices {
             voice.noise_level = level.clamp(0.0, 1.0);
@@ -462,10 +692,21 @@ impl VoiceManager {
         // Would require adding an HPF filter to Voice struct
     }
 
-    /// Set pitch bend value (-1 to 1, where 1 = +pitch_bend_range semitones)
+    /// Set pitch bend value (-1 to 1, where 1 = +pitch_bend_range semitones),
+    /// applied to every channel
     pub fn set_pitch_bend(&mut self, value: f32) {
-        self.pitch_bend = value.clamp(-1.0, 1.0) * self.pitch_bend_range;
-        self.update_voice_frequencies();
+        let semitones = value.clamp(-1.0, 1.0) * self.pitch_bend_range;
+        self.pitch_bend = [semitones; 16];
+        self.update_voice_frequencies(None);
+    }
+
+    /// Per-channel variant of set_pitch_bend: only voices whose note-on
+    /// arrived on `channel` are retuned. With one note per channel (MPE
+    /// member channels) this gives per-note bend.
+    pub fn set_pitch_bend_channel(&mut self, channel: u8, value: f32) {
+        let channel = channel & 15;
+        self.pitch_bend[channel as usize] = value.clamp(-1.0, 1.0) * self.pitch_bend_range;
+        self.update_voice_frequencies(Some(channel));
     }
 
     /// Set pitch bend range in semitones (typically 2, 12, or 24)
@@ -473,23 +714,27 @@ impl VoiceManager {
         self.pitch_bend_range = semitones.clamp(0.0, 48.0);
     }
 
-    /// Update frequencies for all active voices (called when pitch bend changes)
-    fn update_voice_frequencies(&mut self) {
-        let bend_multiplier = (2.0_f32).powf(self.pitch_bend / 12.0);
+    /// Update frequencies for active voices when pitch bend changes;
+    /// `None` means all channels
+    fn update_voice_frequencies(&mut self, channel: Option<u8>) {
+        let bends = self.pitch_bend;
         for voice in &mut self.voices {
-            if voice.active {
+            if voice.active && channel.map_or(true, |c| voice.channel == c) {
+                let bend_multiplier =
+                    (2.0_f32).powf(bends[(voice.channel & 15) as usize] / 12.0);
                 let base_freq = midi_to_freq(voice.note);
                 let bent_freq = base_freq * bend_multiplier;
                 voice.osc1.set_frequency(bent_freq);
                 voice.osc2.set_frequency(bent_freq * voice.fm_ratio);
                 voice.sub_osc.set_frequency(bent_freq * 0.5);
+                voice.refresh_unison(bent_freq);
             }
         }
     }
 
-    /// Get current pitch bend multiplier (for use during note_on)
-    fn pitch_bend_multiplier(&self) -> f32 {
-        (2.0_f32).powf(self.pitch_bend / 12.0)
+    /// Current pitch bend multiplier for a channel (for use during note_on)
+    fn bend_multiplier(&self, channel: u8) -> f32 {
+        (2.0_f32).powf(self.pitch_bend[(channel & 15) as usize] / 12.0)
     }
 
     /// Get mutable access to voices for processing
@@ -529,4 +774,58 @@ mod tests {
         vm.panic();
         assert_eq!(vm.active_voice_count(), 0);
     }
+
+    #[test]
+    fn test_unison_supersaw() {
+        let mut vm = VoiceManager::new(4, 44100.0);
+        vm.set_unison_voices(7);
+        vm.set_unison_detune(50.0);
+        vm.set_unison_spread(1.0);
+        vm.note_on(60, 1.0);
+
+        let mut peak = 0.0f32;
+        for _ in 0..2000 {
+            let s: f32 = vm.voices.iter_mut().map(|v| v.tick(5000.0)).sum();
+            assert!(s.is_finite());
+            peak = peak.max(s.abs());
+        }
+        // The stack is normalized: audible, but no 7x gain explosion
+        assert!(peak > 0.0);
+        assert!(peak < 2.0);
+    }
+
+    #[test]
+    fn test_polyphony_cap_and_stealing() {
+        let mut vm = VoiceManager::new(8, 44100.0);
+        vm.set_max_polyphony(2);
+
+        vm.note_on(60, 0.8);
+        vm.note_on(64, 0.8);
+        assert_eq!(vm.active_voice_count(), 2);
+
+        // Cap reached: the third note steals the oldest voice (note 60)
+        vm.note_on(67, 0.8);
+        assert_eq!(vm.active_voice_count(), 2);
+        assert!(vm.voices.iter().any(|v| v.active && v.note == 67));
+        assert!(!vm.voices.iter().any(|v| v.active && v.note == 60));
+
+        // Lowering the cap silences voices above it
+        vm.set_max_polyphony(1);
+        assert_eq!(vm.active_voice_count(), 1);
+    }
+
+    #[test]
+    fn test_pitch_bend_channel_only_moves_its_voices() {
+        let mut vm = VoiceManager::new(8, 44100.0);
+        vm.note_on_with_channel(60, 0.8, 1);
+        vm.note_on_with_channel(64, 0.8, 2);
+
+        let freq_ch2 = vm.voices[1].osc1.frequency;
+
+        // Full wheel up on channel 1 = +pitch_bend_range (2 st)
+        vm.set_pitch_bend_channel(1, 1.0);
+        let expected = midi_to_freq(60) * (2.0_f32).powf(2.0 / 12.0);
+        assert!((vm.voices[0].osc1.frequency - expected).abs() < 0.01);
+        assert_eq!(vm.voices[1].osc1.frequency, freq_ch2);
+    }
 }
@@ -13,6 +13,168 @@ extern "C" {
 /* Opaque handles */
 typedef void* SubSynthHandle;
 typedef void* FmSynthHandle;
+typedef void* DrumSynthHandle;
+
+/* ============================================================================
+   SHARED ENGINE TABLES
+   ============================================================================ */
+
+/* Build the process-wide read-only lookup tables (sine, etc.) now. Every
+   engine instance shares the same tables, so call this once at session load
+   — e.g. from a juce::SharedResourcePointer in the processor constructor —
+   to front-load the warm-up instead of paying it on the first render.
+   Idempotent and thread-safe; *_create needs no handle because the tables
+   are process-global. */
+void ossian19_tables_init(void);
+
+/* ============================================================================
+   SAMPLE-ACCURATE EVENT SCHEDULING
+   ============================================================================ */
+
+/* Event kinds for MidiEvent */
+enum {
+    MIDI_EVENT_NOTE_ON = 0,
+    MIDI_EVENT_NOTE_OFF = 1,
+    MIDI_EVENT_PITCH_BEND = 2,
+    MIDI_EVENT_ALL_NOTES_OFF = 3
+};
+
+/* A MIDI-style event with a sample-accurate offset into the current block.
+   `value` carries velocity (0.0-1.0) for note-on and bend in semitones for
+   pitch bend; `data` is the note number for note events. */
+typedef struct {
+    uint32_t sample_offset;
+    uint8_t kind;
+    uint8_t channel;   /* MIDI channel, 0-15 */
+    uint8_t data;
+    uint8_t reserved;
+    float value;
+} MidiEvent;
+
+/* Render num_samples of audio, applying each event at its sample_offset.
+   Events must be sorted by sample_offset. */
+void sub_synth_process_events(SubSynthHandle handle, const MidiEvent* events,
+                              size_t num_events, float* left, float* right,
+                              size_t num_samples);
+void fm_synth_process_events(FmSynthHandle handle, const MidiEvent* events,
+                             size_t num_events, float* left, float* right,
+                             size_t num_samples);
+
+/* Frame-interleaved stereo variants (CoreAudio AudioBufferList layout).
+   `lr` holds num_frames L/R pairs; the engine writes it directly, so no
+   planar-to-interleaved copy is needed on either side. */
+void sub_synth_process_interleaved(SubSynthHandle handle, float* lr, size_t num_frames);
+void fm_synth_process_interleaved(FmSynthHandle handle, float* lr, size_t num_frames);
+
+/* Mono variants for single-channel bus layouts: the engine mix is mono
+   internally, so these skip the duplicate channel write. */
+void sub_synth_process_mono(SubSynthHandle handle, float* out, size_t num_samples);
+void fm_synth_process_mono(FmSynthHandle handle, float* out, size_t num_samples);
+void sub_synth_process_events_mono(SubSynthHandle handle, const MidiEvent* events,
+                                   size_t num_events, float* out, size_t num_samples);
+void fm_synth_process_events_mono(FmSynthHandle handle, const MidiEvent* events,
+                                  size_t num_events, float* out, size_t num_samples);
+
+/* Multi-output variant for per-carrier bus routing. `op_outs` points to 6
+   mono buffer pointers in operator order; null entries are skipped. Each
+   non-null buffer receives that operator's summed output across all voices,
+   rendered in the same single engine pass as the main mix. The caller routes
+   the carrier set of the current algorithm and leaves modulator slots null. */
+void fm_synth_process_events_multi(FmSynthHandle handle, const MidiEvent* events,
+                                   size_t num_events, float* main_out,
+                                   float* const* op_outs, size_t num_samples);
+
+/* ============================================================================
+   POLYPHONY
+   ============================================================================ */
+
+/* Voice-steal policies for *_set_steal_policy */
+enum {
+    STEAL_POLICY_OLDEST = 0,
+    STEAL_POLICY_QUIETEST = 1,
+    STEAL_POLICY_SAME_NOTE = 2
+};
+
+/* Cap the number of simultaneous voices (clamped to 1-32). Lowering the cap
+   silences voices above it immediately; no allocation happens, so these are
+   safe to call from the audio thread. */
+void sub_synth_set_max_polyphony(SubSynthHandle handle, int32_t value);
+void sub_synth_set_steal_policy(SubSynthHandle handle, int32_t value);  /* STEAL_POLICY_* */
+void fm_synth_set_max_polyphony(FmSynthHandle handle, int32_t value);
+void fm_synth_set_steal_policy(FmSynthHandle handle, int32_t value);    /* STEAL_POLICY_* */
+
+/* ============================================================================
+   RENDER THREADING
+   ============================================================================ */
+
+/* Opt-in worker-pool rendering: voices are partitioned across the given
+   number of threads (clamped to 1-16) and summed into the caller's buffers.
+   Only blocks of 256+ samples use the pool; smaller blocks fall back to the
+   single-threaded path, as do 0 and 1. The workers are persistent — parked
+   on a condvar between blocks, never spawned per block — but the pool only
+   ever grows: call this with the largest split you will use from
+   prepareToPlay, after which lowering (and re-raising within that ceiling)
+   the count is safe from the render callback. */
+void sub_synth_set_num_threads(SubSynthHandle handle, int32_t value);
+void fm_synth_set_num_threads(FmSynthHandle handle, int32_t value);
+
+/* Preallocate every internal render scratch buffer for blocks up to
+   max_block_size samples, covering all worker counts set_num_threads can
+   later select, so nothing on the audio path allocates — not even the
+   first parallel block or a mid-session thread re-split. Voices are fully
+   allocated when the synth is created, so there is no per-voice warm-up
+   to do. Call from prepareToPlay (pass the engine-side block size, i.e.
+   2x the host's when oversampling). */
+void sub_synth_prewarm(SubSynthHandle handle, int32_t max_block_size);
+void fm_synth_prewarm(FmSynthHandle handle, int32_t max_block_size);
+
+/* Faster-than-realtime bounce mode. Offline only throughput matters, not
+   worst-case callback time, so realtime-only limits are relaxed (currently:
+   the worker pool engages on smaller blocks). Wire to
+   AudioProcessor::setNonRealtime(). */
+void sub_synth_set_offline(SubSynthHandle handle, bool offline);
+void fm_synth_set_offline(FmSynthHandle handle, bool offline);
+
+/* ============================================================================
+   PARAMETER SMOOTHING
+   ============================================================================ */
+
+/* Smoothing contract: the engines glide their global continuous parameters
+   (sub: filter cutoff and master volume; FM: master volume) toward the last
+   set value over the configured window, so sparse setter calls — e.g. a
+   30 Hz UI-rate timer instead of per-block pushes from processBlock() — are
+   click-free. All remaining setters update per-voice state that is either
+   stepped by nature (waveforms, slopes, polyphony) or enters the signal
+   through an envelope/phase accumulator, and are safe to call at any rate.
+   Preset applies (*_apply_preset) snap instead of gliding.
+
+   The window is clamped to 0-100 ms; 0 disables smoothing entirely and
+   values snap on the next sample. Default: 5 ms. */
+void sub_synth_set_smoothing_ms(SubSynthHandle handle, float ms);
+void fm_synth_set_smoothing_ms(FmSynthHandle handle, float ms);
+
+/* ============================================================================
+   TELEMETRY
+   ============================================================================ */
+
+/* Number of currently sounding voices. Safe to call from the audio thread;
+   hosts combine this with their own render-time measurement for meters. */
+int32_t sub_synth_active_voices(SubSynthHandle handle);
+int32_t fm_synth_active_voices(FmSynthHandle handle);
+
+/* ============================================================================
+   CPU BUDGETING
+   ============================================================================ */
+
+/* Graceful degradation under deadline pressure: fade out up to `count` of
+   the quietest voices that are already in their release phase by collapsing
+   their remaining release to ~20 ms. Held notes are never touched, so long
+   pad tails go before anything audible as a played note. Returns how many
+   voices were shed (0 when nothing is releasing). Hosts call this from the
+   render callback when their measured block time crosses a budget
+   threshold; it allocates nothing and touches only envelope state. */
+int32_t sub_synth_shed_voices(SubSynthHandle handle, int32_t count);
+int32_t fm_synth_shed_voices(FmSynthHandle handle, int32_t count);
 
 /* ============================================================================
    SUBTRACTIVE SYNTH
@@ -46,6 +208,14 @@ void sub_synth_set_pulse_width(SubSynthHandle handle, float value);
 void sub_synth_set_pwm_depth(SubSynthHandle handle, float value);
 void sub_synth_set_pwm_rate(SubSynthHandle handle, float value);
 
+/* Unison / supersaw. Detuned copies of osc1 render as one batch inside each
+   voice and share its single filter and envelope pass, so 7-voice unison
+   costs a fraction of 7 engine instances. voices: 1 (off) to 7; detune:
+   symmetric spread in cents (0-100); spread: side-copy level 0-1. */
+void sub_synth_set_unison_voices(SubSynthHandle handle, int32_t value);
+void sub_synth_set_unison_detune(SubSynthHandle handle, float value);
+void sub_synth_set_unison_spread(SubSynthHandle handle, float value);
+
 /* FM */
 void sub_synth_set_fm_amount(SubSynthHandle handle, float value);
 void sub_synth_set_fm_ratio(SubSynthHandle handle, float value);
@@ -65,15 +235,90 @@ void sub_synth_set_filter_adsr(SubSynthHandle handle, float a, float d, float s,
 void sub_synth_set_master_volume(SubSynthHandle handle, float value);
 void sub_synth_set_pitch_bend(SubSynthHandle handle, float semitones);
 
+/* Per-channel (MPE) pitch bend: only voices whose note-on arrived on
+   `channel` (0-15) are retuned. MIDI_EVENT_PITCH_BEND events route through
+   this using the event's channel field, so MPE streams — one note per
+   member channel — get per-note bend while single-channel streams behave
+   exactly like the global setter above. */
+void sub_synth_set_pitch_bend_channel(SubSynthHandle handle, uint8_t channel,
+                                      float semitones);
+
+/* Batched parameter updates.
+   dirty_mask has one bit per parameter: 0=osc1_waveform, 1=osc1_level,
+   2=osc2_waveform, 3=osc2_level, 4=osc2_detune, 5=sub_waveform, 6=sub_level,
+   7=sub_octave, 8=noise_level, 9=pulse_width, 10=pwm_depth, 11=pwm_rate,
+   12=fm_amount, 13=fm_ratio, 14=filter_cutoff, 15=filter_resonance,
+   16=filter_slope, 17=filter_env_amount, 18=hpf_cutoff, 19-22=amp ADSR,
+   23-26=filter ADSR, 27=master_volume, 30=unison_voices, 31=unison_detune,
+   32=unison_spread (28-29 are reserved for host-side masks). Fields whose
+   bit is clear are ignored; pass UINT64_MAX for a full push. The whole
+   block is applied atomically with respect to rendering. */
+typedef struct {
+    uint64_t dirty_mask;
+    int32_t osc1_waveform;
+    int32_t osc2_waveform;
+    int32_t sub_waveform;
+    int32_t sub_octave;
+    int32_t filter_slope;
+    float osc1_level;
+    float osc2_level;
+    float osc2_detune;
+    float sub_level;
+    float noise_level;
+    float pulse_width;
+    float pwm_depth;
+    float pwm_rate;
+    float fm_amount;
+    float fm_ratio;
+    float filter_cutoff;
+    float filter_resonance;
+    float filter_env_amount;
+    float hpf_cutoff;
+    float amp_attack;
+    float amp_decay;
+    float amp_sustain;
+    float amp_release;
+    float filter_attack;
+    float filter_decay;
+    float filter_sustain;
+    float filter_release;
+    float master_volume;
+    /* Appended fields keep earlier offsets ABI-stable */
+    int32_t unison_voices;
+    float unison_detune;
+    float unison_spread;
+} SubParamBlock;
+
+void sub_synth_apply_params(SubSynthHandle handle, const SubParamBlock* params);
+
+/* Apply a complete preset in one call, ignoring the block's dirty mask.
+   When kill_voices is true, sounding voices are hard-stopped first so the
+   old patch's release tails are not rendered with the new parameters. */
+void sub_synth_apply_preset(SubSynthHandle handle, const SubParamBlock* params,
+                            bool kill_voices);
+
 /* ============================================================================
    FM SYNTH (6-Operator)
    ============================================================================ */
 
 FmSynthHandle fm_synth_create(float sample_rate);
 void fm_synth_destroy(FmSynthHandle handle);
+void fm_synth_set_sample_rate(FmSynthHandle handle, float sample_rate);
 void fm_synth_note_on(FmSynthHandle handle, uint8_t note, float velocity);
 void fm_synth_note_off(FmSynthHandle handle, uint8_t note);
 void fm_synth_all_notes_off(FmSynthHandle handle);
+
+/* Pitch bend, same contract as the Sub synth: `semitones` is the wheel
+   deflection mapped to ±12 st, scaled by the engine's ±2 st bend range.
+   Implemented as one bend factor multiplied into the oscillator phase
+   increments — no per-voice frequency recompute — so sweeping the wheel
+   across a full 16-voice pool costs the same as across one voice. The
+   _channel variant retunes only voices started on that channel (0-15);
+   MIDI_EVENT_PITCH_BEND events route through it, giving MPE streams
+   per-note bend. */
+void fm_synth_set_pitch_bend(FmSynthHandle handle, float semitones);
+void fm_synth_set_pitch_bend_channel(FmSynthHandle handle, uint8_t channel,
+                                     float semitones);
 void fm_synth_process(FmSynthHandle handle, float* left, float* right, size_t num_samples);
 
 /* Algorithm (0-31, 32 classic FM algorithms) */
@@ -102,6 +347,97 @@ void fm_synth_set_vibrato_rate(FmSynthHandle handle, float value);
 /* Master */
 void fm_synth_set_master_volume(FmSynthHandle handle, float value);
 
+/* Batched parameter updates.
+   dirty_mask has one bit per parameter: bit 0 = algorithm; bits 1-54 are the
+   per-operator parameters, 9 per operator in FmOpParams field order
+   (bit = 1 + op * 9 + field); bit 55 = filter_enabled, 56 = filter_cutoff,
+   57 = filter_resonance, 58 = vibrato_depth, 59 = vibrato_rate,
+   60 = master_volume. Fields whose bit is clear are ignored; pass UINT64_MAX
+   for a full push. The whole block is applied atomically with respect to
+   rendering. */
+typedef struct {
+    float ratio;
+    float level;
+    float detune;
+    float feedback;
+    float velocity_sens;
+    float attack;
+    float decay;
+    float sustain;
+    float release;
+} FmOpParams;
+
+typedef struct {
+    uint64_t dirty_mask;
+    int32_t algorithm;
+    FmOpParams ops[6];
+    float filter_cutoff;
+    float filter_resonance;
+    float vibrato_depth;
+    float vibrato_rate;
+    float master_volume;
+    bool filter_enabled;
+} FmParamBlock;
+
+void fm_synth_apply_params(FmSynthHandle handle, const FmParamBlock* params);
+
+/* Apply a complete preset in one call, ignoring the block's dirty mask.
+   When kill_voices is true, sounding voices are hard-stopped first so the
+   old patch's release tails are not rendered with the new operator topology. */
+void fm_synth_apply_preset(FmSynthHandle handle, const FmParamBlock* params,
+                           bool kill_voices);
+
+/* ============================================================================
+   DRUM MACHINE
+   ============================================================================ */
+
+/* Drum sound indices for drum_synth_trigger and NOTE_ON events */
+enum {
+    DRUM_SOUND_KICK = 0,
+    DRUM_SOUND_SNARE = 1,
+    DRUM_SOUND_CLAP = 2,
+    DRUM_SOUND_HIHAT_CLOSED = 3,
+    DRUM_SOUND_HIHAT_OPEN = 4,
+    DRUM_SOUND_TOM_LOW = 5,
+    DRUM_SOUND_TOM_MID = 6,
+    DRUM_SOUND_TOM_HI = 7,
+    DRUM_SOUND_RIMSHOT = 8,
+    DRUM_SOUND_COWBELL = 9,
+    DRUM_SOUND_CYMBAL = 10,
+};
+
+/* Kit indices for drum_synth_set_kit */
+enum {
+    DRUM_KIT_808 = 0,
+    DRUM_KIT_909 = 1,
+    DRUM_KIT_707 = 2,
+    DRUM_KIT_CR78 = 3,
+    DRUM_KIT_LINNDRUM = 4,
+};
+
+DrumSynthHandle drum_synth_create(float sample_rate);
+void drum_synth_destroy(DrumSynthHandle handle);
+void drum_synth_set_sample_rate(DrumSynthHandle handle, float sample_rate);
+void drum_synth_set_kit(DrumSynthHandle handle, int32_t kit);          /* DRUM_KIT_* */
+void drum_synth_set_master_volume(DrumSynthHandle handle, float volume);
+
+/* Fire a hit immediately (velocity 0.0-1.0). A closed hat chokes an open
+   one, TR-style; out-of-range sound indices are ignored. */
+void drum_synth_trigger(DrumSynthHandle handle, int32_t sound, float velocity);
+void drum_synth_all_notes_off(DrumSynthHandle handle);
+int32_t drum_synth_active_voices(DrumSynthHandle handle);
+
+/* Render a mono block. Designed for throughput: every sounding voice
+   renders in one batched pass over the buffer (no per-voice traversal),
+   so a dense step of hits costs a single pass. */
+void drum_synth_process(DrumSynthHandle handle, float* out, size_t num_samples);
+
+/* Sample-accurate variant. NOTE_ON events carry the DRUM_SOUND_* index in
+   `data` and velocity in `value`; NOTE_OFF is ignored (one-shot voices),
+   ALL_NOTES_OFF silences the pool. Events must be sorted by sample_offset. */
+void drum_synth_process_events(DrumSynthHandle handle, const MidiEvent* events,
+                               size_t num_events, float* out, size_t num_samples);
+
 #ifdef __cplusplus
 }
 #endif
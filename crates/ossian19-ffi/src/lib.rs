@@ -3,11 +3,99 @@
 
 use ossian19_core::synth::Synth;
 use ossian19_core::fm::Fm6OpVoiceManager;
+use ossian19_core::drums::{DrumKit, DrumMachine, DrumSound};
 use ossian19_core::oscillator::{Waveform, SubWaveform};
 use ossian19_core::filter::FilterSlope;
 use ossian19_core::fm::Dx7Algorithm;
+use ossian19_core::voice::StealPolicy;
 use std::slice;
 
+// ============================================================================
+// SHARED ENGINE TABLES
+// ============================================================================
+
+/// Build the process-wide read-only lookup tables now. The tables are
+/// statics shared by every engine instance, so hosts with many instances
+/// call this once at session load to front-load the warm-up; without it the
+/// first render to need a table builds it lazily. Idempotent, thread-safe.
+#[no_mangle]
+pub extern "C" fn ossian19_tables_init() {
+    ossian19_core::tables::init();
+}
+
+// ============================================================================
+// SAMPLE-ACCURATE EVENT SCHEDULING
+// ============================================================================
+
+// Event kinds for MidiEvent (must match ossian19.h)
+pub const MIDI_EVENT_NOTE_ON: u8 = 0;
+pub const MIDI_EVENT_NOTE_OFF: u8 = 1;
+pub const MIDI_EVENT_PITCH_BEND: u8 = 2;
+pub const MIDI_EVENT_ALL_NOTES_OFF: u8 = 3;
+
+/// A MIDI-style event with a sample-accurate offset into the current block.
+/// Layout must match the C declaration in ossian19.h.
+#[repr(C)]
+pub struct MidiEvent {
+    /// Offset in samples from the start of the block.
+    pub sample_offset: u32,
+    /// Event type (see MIDI_EVENT_* constants). Unknown kinds are ignored.
+    pub kind: u8,
+    /// MIDI channel (0-15).
+    pub channel: u8,
+    /// Note number for note events; unused otherwise.
+    pub data: u8,
+    pub reserved: u8,
+    /// Velocity (0.0-1.0) for note-on, bend in semitones for pitch bend.
+    pub value: f32,
+}
+
+fn waveform_from_i32(value: i32) -> Waveform {
+    match value {
+        0 => Waveform::Saw,
+        1 => Waveform::Square,
+        2 => Waveform::Triangle,
+        3 => Waveform::Sine,
+        _ => Waveform::Saw,
+    }
+}
+
+fn sub_waveform_from_i32(value: i32) -> SubWaveform {
+    match value {
+        0 => SubWaveform::Sine,
+        1 => SubWaveform::Square,
+        _ => SubWaveform::Sine,
+    }
+}
+
+// Voice-steal policies (must match ossian19.h)
+pub const STEAL_POLICY_OLDEST: i32 = 0;
+pub const STEAL_POLICY_QUIETEST: i32 = 1;
+pub const STEAL_POLICY_SAME_NOTE: i32 = 2;
+
+/// Voices preallocated per engine; set_max_polyphony caps usage within this
+/// pool so changing the cap never allocates on the audio thread.
+const MAX_VOICES: usize = 32;
+/// Effective polyphony at creation (matches the previous fixed voice count).
+const DEFAULT_POLYPHONY: usize = 8;
+
+fn steal_policy_from_i32(value: i32) -> StealPolicy {
+    match value {
+        STEAL_POLICY_QUIETEST => StealPolicy::Quietest,
+        STEAL_POLICY_SAME_NOTE => StealPolicy::SameNote,
+        _ => StealPolicy::Oldest,
+    }
+}
+
+fn filter_slope_from_i32(value: i32) -> FilterSlope {
+    match value {
+        0 => FilterSlope::Pole1,  // 6 dB
+        1 => FilterSlope::Pole2,  // 12 dB
+        2 => FilterSlope::Pole4,  // 24 dB
+        _ => FilterSlope::Pole4,
+    }
+}
+
 // ============================================================================
 // SUBTRACTIVE SYNTH FFI
 // ============================================================================
@@ -15,7 +103,8 @@ use std::slice;
 /// Create a new subtractive synth instance
 #[no_mangle]
 pub extern "C" fn sub_synth_create(sample_rate: f32) -> *mut Synth {
-    let synth = Box::new(Synth::new(sample_rate, 8));
+    let mut synth = Box::new(Synth::new(sample_rate, MAX_VOICES));
+    synth.set_max_polyphony(DEFAULT_POLYPHONY);
     Box::into_raw(synth)
 }
 
@@ -78,19 +167,147 @@ pub extern "C" fn sub_synth_process(
     s.process_stereo(left_slice, right_slice);
 }
 
+/// Process audio with sample-accurate event scheduling. Events must be
+/// sorted by sample_offset (JUCE MidiBuffer iteration order); audio is
+/// rendered in segments between events so note timing does not quantize
+/// to block boundaries.
+#[no_mangle]
+pub extern "C" fn sub_synth_process_events(
+    handle: *mut Synth,
+    events: *const MidiEvent,
+    num_events: usize,
+    left: *mut f32,
+    right: *mut f32,
+    num_samples: usize,
+) {
+    if handle.is_null() || left.is_null() || right.is_null() {
+        return;
+    }
+    if events.is_null() && num_events > 0 {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let left_slice = unsafe { slice::from_raw_parts_mut(left, num_samples) };
+    let right_slice = unsafe { slice::from_raw_parts_mut(right, num_samples) };
+    let events: &[MidiEvent] = if num_events == 0 {
+        &[]
+    } else {
+        unsafe { slice::from_raw_parts(events, num_events) }
+    };
+
+    let mut cursor = 0usize;
+    for event in events {
+        let offset = (event.sample_offset as usize).min(num_samples);
+        if offset > cursor {
+            s.process_stereo(&mut left_slice[cursor..offset], &mut right_slice[cursor..offset]);
+            cursor = offset;
+        }
+        match event.kind {
+            MIDI_EVENT_NOTE_ON => {
+                s.note_on_with_channel(event.data, (event.value * 127.0) as u8, event.channel)
+            }
+            MIDI_EVENT_NOTE_OFF => s.note_off(event.data),
+            MIDI_EVENT_PITCH_BEND => s.set_pitch_bend_channel(event.channel, event.value / 12.0),
+            MIDI_EVENT_ALL_NOTES_OFF => s.all_notes_off(),
+            _ => {}
+        }
+    }
+    if cursor < num_samples {
+        s.process_stereo(&mut left_slice[cursor..], &mut right_slice[cursor..]);
+    }
+}
+
+/// Process audio block (frame-interleaved stereo, CoreAudio AudioBufferList
+/// layout). The mono mix is rendered into the first half of `lr`, then
+/// expanded in place back-to-front, so no scratch buffer or host-side
+/// deinterleave copy is needed.
+#[no_mangle]
+pub extern "C" fn sub_synth_process_interleaved(
+    handle: *mut Synth,
+    lr: *mut f32,
+    num_frames: usize,
+) {
+    if handle.is_null() || lr.is_null() {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let lr_slice = unsafe { slice::from_raw_parts_mut(lr, num_frames * 2) };
+
+    s.process(&mut lr_slice[..num_frames]);
+    for i in (0..num_frames).rev() {
+        let sample = lr_slice[i];
+        lr_slice[2 * i] = sample;
+        lr_slice[2 * i + 1] = sample;
+    }
+}
+
+/// Process audio block (mono). The engine mix is mono internally, so this
+/// skips the duplicate channel write entirely.
+#[no_mangle]
+pub extern "C" fn sub_synth_process_mono(handle: *mut Synth, out: *mut f32, num_samples: usize) {
+    if handle.is_null() || out.is_null() {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let out_slice = unsafe { slice::from_raw_parts_mut(out, num_samples) };
+    s.process(out_slice);
+}
+
+/// Mono variant of sub_synth_process_events (same event contract)
+#[no_mangle]
+pub extern "C" fn sub_synth_process_events_mono(
+    handle: *mut Synth,
+    events: *const MidiEvent,
+    num_events: usize,
+    out: *mut f32,
+    num_samples: usize,
+) {
+    if handle.is_null() || out.is_null() {
+        return;
+    }
+    if events.is_null() && num_events > 0 {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let out_slice = unsafe { slice::from_raw_parts_mut(out, num_samples) };
+    let events: &[MidiEvent] = if num_events == 0 {
+        &[]
+    } else {
+        unsafe { slice::from_raw_parts(events, num_events) }
+    };
+
+    let mut cursor = 0usize;
+    for event in events {
+        let offset = (event.sample_offset as usize).min(num_samples);
+        if offset > cursor {
+            s.process(&mut out_slice[cursor..offset]);
+            cursor = offset;
+        }
+        match event.kind {
+            MIDI_EVENT_NOTE_ON => {
+                s.note_on_with_channel(event.data, (event.value * 127.0) as u8, event.channel)
+            }
+            MIDI_EVENT_NOTE_OFF => s.note_off(event.data),
+            MIDI_EVENT_PITCH_BEND => s.set_pitch_bend_channel(event.channel, event.value / 12.0),
+            MIDI_EVENT_ALL_NOTES_OFF => s.all_notes_off(),
+            _ => {}
+        }
+    }
+    if cursor < num_samples {
+        s.process(&mut out_slice[cursor..]);
+    }
+}
+
 // --- Sub Synth Parameters ---
 
 #[no_mangle]
 pub extern "C" fn sub_synth_set_osc1_waveform(handle: *mut Synth, value: i32) {
     if let Some(s) = unsafe { handle.as_mut() } {
-        let wf = match value {
-            0 => Waveform::Saw,
-            1 => Waveform::Square,
-            2 => Waveform::Triangle,
-            3 => Waveform::Sine,
-            _ => Waveform::Saw,
-        };
-        s.set_osc1_waveform(wf);
+        s.set_osc1_waveform(waveform_from_i32(value));
     }
 }
 
@@ -104,14 +321,7 @@ pub extern "C" fn sub_synth_set_osc1_level(handle: *mut Synth, value: f32) {
 #[no_mangle]
 pub extern "C" fn sub_synth_set_osc2_waveform(handle: *mut Synth, value: i32) {
     if let Some(s) = unsafe { handle.as_mut() } {
-        let wf = match value {
-            0 => Waveform::Saw,
-            1 => Waveform::Square,
-            2 => Waveform::Triangle,
-            3 => Waveform::Sine,
-            _ => Waveform::Saw,
-        };
-        s.set_osc2_waveform(wf);
+        s.set_osc2_waveform(waveform_from_i32(value));
     }
 }
 
@@ -132,12 +342,7 @@ pub extern "C" fn sub_synth_set_osc2_detune(handle: *mut Synth, value: f32) {
 #[no_mangle]
 pub extern "C" fn sub_synth_set_sub_waveform(handle: *mut Synth, value: i32) {
     if let Some(s) = unsafe { handle.as_mut() } {
-        let wf = match value {
-            0 => SubWaveform::Sine,
-            1 => SubWaveform::Square,
-            _ => SubWaveform::Sine,
-        };
-        s.set_sub_waveform(wf);
+        s.set_sub_waveform(sub_waveform_from_i32(value));
     }
 }
 
@@ -183,6 +388,31 @@ pub extern "C" fn sub_synth_set_pwm_rate(handle: *mut Synth, value: f32) {
     }
 }
 
+/// Unison copy count (1 = off, clamped to 7). All copies render inside the
+/// voice and share its single filter and envelope pass.
+#[no_mangle]
+pub extern "C" fn sub_synth_set_unison_voices(handle: *mut Synth, value: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_unison_voices(value.max(1) as usize);
+    }
+}
+
+/// Unison detune spread in cents (0-100, symmetric around the note)
+#[no_mangle]
+pub extern "C" fn sub_synth_set_unison_detune(handle: *mut Synth, value: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_unison_detune(value);
+    }
+}
+
+/// Side-copy level relative to the centre oscillator (0-1)
+#[no_mangle]
+pub extern "C" fn sub_synth_set_unison_spread(handle: *mut Synth, value: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_unison_spread(value);
+    }
+}
+
 #[no_mangle]
 pub extern "C" fn sub_synth_set_fm_amount(handle: *mut Synth, value: f32) {
     if let Some(s) = unsafe { handle.as_mut() } {
@@ -214,13 +444,7 @@ pub extern "C" fn sub_synth_set_filter_resonance(handle: *mut Synth, value: f32)
 #[no_mangle]
 pub extern "C" fn sub_synth_set_filter_slope(handle: *mut Synth, value: i32) {
     if let Some(s) = unsafe { handle.as_mut() } {
-        let slope = match value {
-            0 => FilterSlope::Pole1,  // 6 dB
-            1 => FilterSlope::Pole2,  // 12 dB
-            2 => FilterSlope::Pole4,  // 24 dB
-            _ => FilterSlope::Pole4,
-        };
-        s.set_filter_slope(slope);
+        s.set_filter_slope(filter_slope_from_i32(value));
     }
 }
 
@@ -266,6 +490,278 @@ pub extern "C" fn sub_synth_set_pitch_bend(handle: *mut Synth, semitones: f32) {
     }
 }
 
+/// Per-channel (MPE) pitch bend: only voices started on `channel` move
+#[no_mangle]
+pub extern "C" fn sub_synth_set_pitch_bend_channel(
+    handle: *mut Synth,
+    channel: u8,
+    semitones: f32,
+) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_pitch_bend_channel(channel, semitones / 12.0);
+    }
+}
+
+/// Cap the number of simultaneous voices (clamped to 1-32, no allocation)
+#[no_mangle]
+pub extern "C" fn sub_synth_set_max_polyphony(handle: *mut Synth, value: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_max_polyphony(value.max(1) as usize);
+    }
+}
+
+/// Select the voice-steal policy (see STEAL_POLICY_* constants)
+#[no_mangle]
+pub extern "C" fn sub_synth_set_steal_policy(handle: *mut Synth, value: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_steal_policy(steal_policy_from_i32(value));
+    }
+}
+
+/// Opt into worker-pool voice rendering (0 or 1 = single-threaded).
+/// Call from prepareToPlay, not from the render callback.
+#[no_mangle]
+pub extern "C" fn sub_synth_set_num_threads(handle: *mut Synth, value: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_num_threads(value.max(1) as usize);
+    }
+}
+
+/// Preallocate internal render scratch for blocks up to `max_block_size`
+/// samples so the audio path never allocates. Call from prepareToPlay.
+#[no_mangle]
+pub extern "C" fn sub_synth_prewarm(handle: *mut Synth, max_block_size: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.prewarm(max_block_size.max(0) as usize);
+    }
+}
+
+/// Toggle faster-than-realtime bounce mode (relaxes realtime-only limits)
+#[no_mangle]
+pub extern "C" fn sub_synth_set_offline(handle: *mut Synth, offline: bool) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_offline(offline);
+    }
+}
+
+/// Glide window for the smoothed global parameters (clamped to 0-100 ms;
+/// 0 disables smoothing). See the smoothing contract in ossian19.h.
+#[no_mangle]
+pub extern "C" fn sub_synth_set_smoothing_ms(handle: *mut Synth, ms: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_smoothing_ms(ms);
+    }
+}
+
+/// Number of currently sounding voices (engine-side telemetry)
+#[no_mangle]
+pub extern "C" fn sub_synth_active_voices(handle: *const Synth) -> i32 {
+    match unsafe { handle.as_ref() } {
+        Some(s) => s.active_voice_count() as i32,
+        None => 0,
+    }
+}
+
+/// CPU budgeter escape valve: fade out up to `count` of the quietest voices
+/// already in their release phase (their remaining release collapses to
+/// ~20 ms; held notes are never touched). Returns the number shed.
+#[no_mangle]
+pub extern "C" fn sub_synth_shed_voices(handle: *mut Synth, count: i32) -> i32 {
+    match unsafe { handle.as_mut() } {
+        Some(s) => s.shed_quietest_release(count.max(0) as usize) as i32,
+        None => 0,
+    }
+}
+
+// --- Sub Synth Batched Parameters ---
+
+// Dirty-mask bit positions for SubParamBlock (must match ossian19.h)
+pub const SUB_BIT_OSC1_WAVEFORM: u64 = 1 << 0;
+pub const SUB_BIT_OSC1_LEVEL: u64 = 1 << 1;
+pub const SUB_BIT_OSC2_WAVEFORM: u64 = 1 << 2;
+pub const SUB_BIT_OSC2_LEVEL: u64 = 1 << 3;
+pub const SUB_BIT_OSC2_DETUNE: u64 = 1 << 4;
+pub const SUB_BIT_SUB_WAVEFORM: u64 = 1 << 5;
+pub const SUB_BIT_SUB_LEVEL: u64 = 1 << 6;
+pub const SUB_BIT_SUB_OCTAVE: u64 = 1 << 7;
+pub const SUB_BIT_NOISE_LEVEL: u64 = 1 << 8;
+pub const SUB_BIT_PULSE_WIDTH: u64 = 1 << 9;
+pub const SUB_BIT_PWM_DEPTH: u64 = 1 << 10;
+pub const SUB_BIT_PWM_RATE: u64 = 1 << 11;
+pub const SUB_BIT_FM_AMOUNT: u64 = 1 << 12;
+pub const SUB_BIT_FM_RATIO: u64 = 1 << 13;
+pub const SUB_BIT_FILTER_CUTOFF: u64 = 1 << 14;
+pub const SUB_BIT_FILTER_RESONANCE: u64 = 1 << 15;
+pub const SUB_BIT_FILTER_SLOPE: u64 = 1 << 16;
+pub const SUB_BIT_FILTER_ENV_AMOUNT: u64 = 1 << 17;
+pub const SUB_BIT_HPF_CUTOFF: u64 = 1 << 18;
+pub const SUB_BITS_AMP_ADSR: u64 = 0xF << 19;
+pub const SUB_BITS_FILTER_ADSR: u64 = 0xF << 23;
+pub const SUB_BIT_MASTER_VOLUME: u64 = 1 << 27;
+// Bits 28-29 are reserved for the host-side polyphony/steal-mode mask
+pub const SUB_BIT_UNISON_VOICES: u64 = 1 << 30;
+pub const SUB_BIT_UNISON_DETUNE: u64 = 1 << 31;
+pub const SUB_BIT_UNISON_SPREAD: u64 = 1 << 32;
+
+/// Packed parameter set for the subtractive synth. Layout must match the
+/// C declaration in ossian19.h exactly (repr(C), no implicit reordering).
+#[repr(C)]
+pub struct SubParamBlock {
+    /// One bit per parameter (see SUB_BIT_* constants). Fields whose bit is
+    /// clear are ignored; pass u64::MAX for a full push.
+    pub dirty_mask: u64,
+    pub osc1_waveform: i32,
+    pub osc2_waveform: i32,
+    pub sub_waveform: i32,
+    pub sub_octave: i32,
+    pub filter_slope: i32,
+    pub osc1_level: f32,
+    pub osc2_level: f32,
+    pub osc2_detune: f32,
+    pub sub_level: f32,
+    pub noise_level: f32,
+    pub pulse_width: f32,
+    pub pwm_depth: f32,
+    pub pwm_rate: f32,
+    pub fm_amount: f32,
+    pub fm_ratio: f32,
+    pub filter_cutoff: f32,
+    pub filter_resonance: f32,
+    pub filter_env_amount: f32,
+    pub hpf_cutoff: f32,
+    pub amp_attack: f32,
+    pub amp_decay: f32,
+    pub amp_sustain: f32,
+    pub amp_release: f32,
+    pub filter_attack: f32,
+    pub filter_decay: f32,
+    pub filter_sustain: f32,
+    pub filter_release: f32,
+    pub master_volume: f32,
+    // Appended fields keep earlier offsets ABI-stable
+    pub unison_voices: i32,
+    pub unison_detune: f32,
+    pub unison_spread: f32,
+}
+
+/// Apply a batch of parameters in a single call. The whole block is applied
+/// before the next sample is rendered, so an automation pass can never land
+/// mid-way through a parameter sequence.
+#[no_mangle]
+pub extern "C" fn sub_synth_apply_params(handle: *mut Synth, params: *const SubParamBlock) {
+    let s = match unsafe { handle.as_mut() } {
+        Some(s) => s,
+        None => return,
+    };
+    let p = match unsafe { params.as_ref() } {
+        Some(p) => p,
+        None => return,
+    };
+    sub_apply_block(s, p, p.dirty_mask);
+}
+
+/// Apply a complete preset in one call, ignoring the block's dirty mask.
+/// When `kill_voices` is true, sounding voices are hard-stopped first so the
+/// old patch's release tails are not rendered with the new parameters.
+#[no_mangle]
+pub extern "C" fn sub_synth_apply_preset(
+    handle: *mut Synth,
+    params: *const SubParamBlock,
+    kill_voices: bool,
+) {
+    let s = match unsafe { handle.as_mut() } {
+        Some(s) => s,
+        None => return,
+    };
+    let p = match unsafe { params.as_ref() } {
+        Some(p) => p,
+        None => return,
+    };
+    if kill_voices {
+        s.panic();
+    }
+    sub_apply_block(s, p, u64::MAX);
+    s.snap_smoothed();
+}
+
+fn sub_apply_block(s: &mut Synth, p: &SubParamBlock, mask: u64) {
+    if mask & SUB_BIT_OSC1_WAVEFORM != 0 {
+        s.set_osc1_waveform(waveform_from_i32(p.osc1_waveform));
+    }
+    if mask & SUB_BIT_OSC1_LEVEL != 0 {
+        s.set_osc1_level(p.osc1_level);
+    }
+    if mask & SUB_BIT_OSC2_WAVEFORM != 0 {
+        s.set_osc2_waveform(waveform_from_i32(p.osc2_waveform));
+    }
+    if mask & SUB_BIT_OSC2_LEVEL != 0 {
+        s.set_osc2_level(p.osc2_level);
+    }
+    if mask & SUB_BIT_OSC2_DETUNE != 0 {
+        s.set_osc2_detune(p.osc2_detune);
+    }
+    if mask & SUB_BIT_SUB_WAVEFORM != 0 {
+        s.set_sub_waveform(sub_waveform_from_i32(p.sub_waveform));
+    }
+    if mask & SUB_BIT_SUB_LEVEL != 0 {
+        s.set_sub_level(p.sub_level);
+    }
+    if mask & SUB_BIT_SUB_OCTAVE != 0 {
+        s.set_sub_octave(p.sub_octave as i8);
+    }
+    if mask & SUB_BIT_NOISE_LEVEL != 0 {
+        s.set_noise_level(p.noise_level);
+    }
+    if mask & SUB_BIT_PULSE_WIDTH != 0 {
+        s.set_pulse_width(p.pulse_width);
+    }
+    if mask & SUB_BIT_PWM_DEPTH != 0 {
+        s.set_pwm_depth(p.pwm_depth);
+    }
+    if mask & SUB_BIT_PWM_RATE != 0 {
+        s.set_pwm_rate(p.pwm_rate);
+    }
+    if mask & SUB_BIT_FM_AMOUNT != 0 {
+        s.set_fm_amount(p.fm_amount);
+    }
+    if mask & SUB_BIT_FM_RATIO != 0 {
+        s.set_fm_ratio(p.fm_ratio);
+    }
+    if mask & SUB_BIT_FILTER_CUTOFF != 0 {
+        s.set_filter_cutoff(p.filter_cutoff);
+    }
+    if mask & SUB_BIT_FILTER_RESONANCE != 0 {
+        s.set_filter_resonance(p.filter_resonance);
+    }
+    if mask & SUB_BIT_FILTER_SLOPE != 0 {
+        s.set_filter_slope(filter_slope_from_i32(p.filter_slope));
+    }
+    if mask & SUB_BIT_FILTER_ENV_AMOUNT != 0 {
+        s.set_filter_env_amount(p.filter_env_amount);
+    }
+    if mask & SUB_BIT_HPF_CUTOFF != 0 {
+        s.set_hpf_cutoff(p.hpf_cutoff);
+    }
+    if mask & SUB_BITS_AMP_ADSR != 0 {
+        s.set_amp_adsr(p.amp_attack, p.amp_decay, p.amp_sustain, p.amp_release);
+    }
+    if mask & SUB_BITS_FILTER_ADSR != 0 {
+        s.set_filter_adsr(p.filter_attack, p.filter_decay, p.filter_sustain, p.filter_release);
+    }
+    if mask & SUB_BIT_MASTER_VOLUME != 0 {
+        s.set_master_volume(p.master_volume);
+    }
+    if mask & SUB_BIT_UNISON_VOICES != 0 {
+        s.set_unison_voices(p.unison_voices.max(1) as usize);
+    }
+    if mask & SUB_BIT_UNISON_DETUNE != 0 {
+        s.set_unison_detune(p.unison_detune);
+    }
+    if mask & SUB_BIT_UNISON_SPREAD != 0 {
+        s.set_unison_spread(p.unison_spread);
+    }
+}
+
 // ============================================================================
 // FM SYNTH FFI
 // ============================================================================
@@ -273,7 +769,8 @@ pub extern "C" fn sub_synth_set_pitch_bend(handle: *mut Synth, semitones: f32) {
 /// Create a new FM synth instance
 #[no_mangle]
 pub extern "C" fn fm_synth_create(sample_rate: f32) -> *mut Fm6OpVoiceManager {
-    let synth = Box::new(Fm6OpVoiceManager::new(8, sample_rate));
+    let mut synth = Box::new(Fm6OpVoiceManager::new(MAX_VOICES, sample_rate));
+    synth.set_max_polyphony(DEFAULT_POLYPHONY);
     Box::into_raw(synth)
 }
 
@@ -285,6 +782,14 @@ pub extern "C" fn fm_synth_destroy(handle: *mut Fm6OpVoiceManager) {
     }
 }
 
+/// Set sample rate (reconfigures voices in place, no allocation)
+#[no_mangle]
+pub extern "C" fn fm_synth_set_sample_rate(handle: *mut Fm6OpVoiceManager, sample_rate: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_sample_rate(sample_rate);
+    }
+}
+
 /// Note on
 #[no_mangle]
 pub extern "C" fn fm_synth_note_on(handle: *mut Fm6OpVoiceManager, note: u8, velocity: f32) {
@@ -309,6 +814,29 @@ pub extern "C" fn fm_synth_all_notes_off(handle: *mut Fm6OpVoiceManager) {
     }
 }
 
+/// Pitch bend, applied to every sounding voice. The engine folds one
+/// 2^(st/12) factor into the oscillator phase increments rather than
+/// re-deriving per-voice note frequencies, so this is cheap to call at
+/// bend-sweep rates.
+#[no_mangle]
+pub extern "C" fn fm_synth_set_pitch_bend(handle: *mut Fm6OpVoiceManager, semitones: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_pitch_bend(semitones / 12.0); // Normalize to -1..1 range
+    }
+}
+
+/// Per-channel (MPE) pitch bend: only voices started on `channel` move
+#[no_mangle]
+pub extern "C" fn fm_synth_set_pitch_bend_channel(
+    handle: *mut Fm6OpVoiceManager,
+    channel: u8,
+    semitones: f32,
+) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_pitch_bend_channel(channel, semitones / 12.0);
+    }
+}
+
 /// Process audio block (stereo, mono duplicated)
 #[no_mangle]
 pub extern "C" fn fm_synth_process(
@@ -325,10 +853,208 @@ pub extern "C" fn fm_synth_process(
     let left_slice = unsafe { slice::from_raw_parts_mut(left, num_samples) };
     let right_slice = unsafe { slice::from_raw_parts_mut(right, num_samples) };
 
-    for i in 0..num_samples {
-        let sample = s.tick();
-        left_slice[i] = sample;
-        right_slice[i] = sample;
+    s.process(left_slice);
+    right_slice.copy_from_slice(left_slice);
+}
+
+/// Process audio with sample-accurate event scheduling. Events must be
+/// sorted by sample_offset (JUCE MidiBuffer iteration order); audio is
+/// rendered in segments between events so note timing does not quantize
+/// to block boundaries.
+#[no_mangle]
+pub extern "C" fn fm_synth_process_events(
+    handle: *mut Fm6OpVoiceManager,
+    events: *const MidiEvent,
+    num_events: usize,
+    left: *mut f32,
+    right: *mut f32,
+    num_samples: usize,
+) {
+    if handle.is_null() || left.is_null() || right.is_null() {
+        return;
+    }
+    if events.is_null() && num_events > 0 {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let left_slice = unsafe { slice::from_raw_parts_mut(left, num_samples) };
+    let right_slice = unsafe { slice::from_raw_parts_mut(right, num_samples) };
+    let events: &[MidiEvent] = if num_events == 0 {
+        &[]
+    } else {
+        unsafe { slice::from_raw_parts(events, num_events) }
+    };
+
+    let mut cursor = 0usize;
+    for event in events {
+        let offset = (event.sample_offset as usize).min(num_samples);
+        if cursor < offset {
+            s.process(&mut left_slice[cursor..offset]);
+            right_slice[cursor..offset].copy_from_slice(&left_slice[cursor..offset]);
+            cursor = offset;
+        }
+        match event.kind {
+            MIDI_EVENT_NOTE_ON => s.note_on_with_channel(event.data, event.value, event.channel),
+            MIDI_EVENT_NOTE_OFF => s.note_off(event.data),
+            MIDI_EVENT_PITCH_BEND => s.set_pitch_bend_channel(event.channel, event.value / 12.0),
+            MIDI_EVENT_ALL_NOTES_OFF => s.panic(),
+            _ => {}
+        }
+    }
+    if cursor < num_samples {
+        s.process(&mut left_slice[cursor..]);
+        right_slice[cursor..].copy_from_slice(&left_slice[cursor..]);
+    }
+}
+
+/// Process audio block (frame-interleaved stereo, CoreAudio AudioBufferList
+/// layout). The mono mix is rendered into the first half of `lr`, then
+/// expanded in place back-to-front, so no scratch buffer or host-side
+/// deinterleave copy is needed.
+#[no_mangle]
+pub extern "C" fn fm_synth_process_interleaved(
+    handle: *mut Fm6OpVoiceManager,
+    lr: *mut f32,
+    num_frames: usize,
+) {
+    if handle.is_null() || lr.is_null() {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let lr_slice = unsafe { slice::from_raw_parts_mut(lr, num_frames * 2) };
+
+    s.process(&mut lr_slice[..num_frames]);
+    for i in (0..num_frames).rev() {
+        let sample = lr_slice[i];
+        lr_slice[2 * i] = sample;
+        lr_slice[2 * i + 1] = sample;
+    }
+}
+
+/// Process audio block (mono). The engine mix is mono internally, so this
+/// skips the duplicate channel write entirely.
+#[no_mangle]
+pub extern "C" fn fm_synth_process_mono(
+    handle: *mut Fm6OpVoiceManager,
+    out: *mut f32,
+    num_samples: usize,
+) {
+    if handle.is_null() || out.is_null() {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let out_slice = unsafe { slice::from_raw_parts_mut(out, num_samples) };
+    s.process(out_slice);
+}
+
+/// Mono variant of fm_synth_process_events (same event contract)
+#[no_mangle]
+pub extern "C" fn fm_synth_process_events_mono(
+    handle: *mut Fm6OpVoiceManager,
+    events: *const MidiEvent,
+    num_events: usize,
+    out: *mut f32,
+    num_samples: usize,
+) {
+    if handle.is_null() || out.is_null() {
+        return;
+    }
+    if events.is_null() && num_events > 0 {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let out_slice = unsafe { slice::from_raw_parts_mut(out, num_samples) };
+    let events: &[MidiEvent] = if num_events == 0 {
+        &[]
+    } else {
+        unsafe { slice::from_raw_parts(events, num_events) }
+    };
+
+    let mut cursor = 0usize;
+    for event in events {
+        let offset = (event.sample_offset as usize).min(num_samples);
+        if cursor < offset {
+            s.process(&mut out_slice[cursor..offset]);
+            cursor = offset;
+        }
+        match event.kind {
+            MIDI_EVENT_NOTE_ON => s.note_on_with_channel(event.data, event.value, event.channel),
+            MIDI_EVENT_NOTE_OFF => s.note_off(event.data),
+            MIDI_EVENT_PITCH_BEND => s.set_pitch_bend_channel(event.channel, event.value / 12.0),
+            MIDI_EVENT_ALL_NOTES_OFF => s.panic(),
+            _ => {}
+        }
+    }
+    if cursor < num_samples {
+        s.process(&mut out_slice[cursor..]);
+    }
+}
+
+/// Multi-output variant of fm_synth_process_events_mono. `op_outs` points to
+/// 6 mono buffer pointers in operator order; null entries are skipped. Each
+/// non-null buffer receives that operator's summed output across all voices
+/// (the caller routes the carrier set for the current algorithm and leaves
+/// modulator slots null). One engine pass feeds every bus.
+#[no_mangle]
+pub extern "C" fn fm_synth_process_events_multi(
+    handle: *mut Fm6OpVoiceManager,
+    events: *const MidiEvent,
+    num_events: usize,
+    main: *mut f32,
+    op_outs: *const *mut f32,
+    num_samples: usize,
+) {
+    if handle.is_null() || main.is_null() || op_outs.is_null() {
+        return;
+    }
+    if events.is_null() && num_events > 0 {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let main_slice = unsafe { slice::from_raw_parts_mut(main, num_samples) };
+    let out_ptrs: [*mut f32; 6] =
+        unsafe { std::array::from_fn(|i| *op_outs.add(i)) };
+    let events: &[MidiEvent] = if num_events == 0 {
+        &[]
+    } else {
+        unsafe { slice::from_raw_parts(events, num_events) }
+    };
+
+    // Re-slice the raw tap pointers per segment so event-split rendering
+    // works the same as the other process_events variants.
+    let render = |s: &mut Fm6OpVoiceManager, main_seg: &mut [f32], from: usize| {
+        let mut op_slices: [Option<&mut [f32]>; 6] = std::array::from_fn(|i| {
+            if out_ptrs[i].is_null() {
+                None
+            } else {
+                Some(unsafe { slice::from_raw_parts_mut(out_ptrs[i].add(from), main_seg.len()) })
+            }
+        });
+        s.process_multi(main_seg, &mut op_slices);
+    };
+
+    let mut cursor = 0usize;
+    for event in events {
+        let offset = (event.sample_offset as usize).min(num_samples);
+        if cursor < offset {
+            render(s, &mut main_slice[cursor..offset], cursor);
+            cursor = offset;
+        }
+        match event.kind {
+            MIDI_EVENT_NOTE_ON => s.note_on_with_channel(event.data, event.value, event.channel),
+            MIDI_EVENT_NOTE_OFF => s.note_off(event.data),
+            MIDI_EVENT_PITCH_BEND => s.set_pitch_bend_channel(event.channel, event.value / 12.0),
+            MIDI_EVENT_ALL_NOTES_OFF => s.panic(),
+            _ => {}
+        }
+    }
+    if cursor < num_samples {
+        render(s, &mut main_slice[cursor..], cursor);
     }
 }
 
@@ -445,3 +1171,357 @@ pub extern "C" fn fm_synth_set_master_volume(handle: *mut Fm6OpVoiceManager, val
         s.set_master_volume(value);
     }
 }
+
+/// Cap the number of simultaneous voices (clamped to 1-32, no allocation)
+#[no_mangle]
+pub extern "C" fn fm_synth_set_max_polyphony(handle: *mut Fm6OpVoiceManager, value: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_max_polyphony(value.max(1) as usize);
+    }
+}
+
+/// Select the voice-steal policy (see STEAL_POLICY_* constants)
+#[no_mangle]
+pub extern "C" fn fm_synth_set_steal_policy(handle: *mut Fm6OpVoiceManager, value: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_steal_policy(steal_policy_from_i32(value));
+    }
+}
+
+/// Opt into worker-pool voice rendering (0 or 1 = single-threaded).
+/// Call from prepareToPlay, not from the render callback.
+#[no_mangle]
+pub extern "C" fn fm_synth_set_num_threads(handle: *mut Fm6OpVoiceManager, value: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_num_threads(value.max(1) as usize);
+    }
+}
+
+/// Preallocate internal render scratch for blocks up to `max_block_size`
+/// samples so the audio path never allocates. Call from prepareToPlay.
+#[no_mangle]
+pub extern "C" fn fm_synth_prewarm(handle: *mut Fm6OpVoiceManager, max_block_size: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.prewarm(max_block_size.max(0) as usize);
+    }
+}
+
+/// Toggle faster-than-realtime bounce mode (relaxes realtime-only limits)
+#[no_mangle]
+pub extern "C" fn fm_synth_set_offline(handle: *mut Fm6OpVoiceManager, offline: bool) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_offline(offline);
+    }
+}
+
+/// Glide window for the smoothed master volume (clamped to 0-100 ms;
+/// 0 disables smoothing). See the smoothing contract in ossian19.h.
+#[no_mangle]
+pub extern "C" fn fm_synth_set_smoothing_ms(handle: *mut Fm6OpVoiceManager, ms: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_smoothing_ms(ms);
+    }
+}
+
+/// Number of currently sounding voices (engine-side telemetry)
+#[no_mangle]
+pub extern "C" fn fm_synth_active_voices(handle: *const Fm6OpVoiceManager) -> i32 {
+    match unsafe { handle.as_ref() } {
+        Some(s) => s.active_voice_count() as i32,
+        None => 0,
+    }
+}
+
+/// CPU budgeter escape valve: fade out up to `count` of the quietest voices
+/// whose carriers are all in their release phase (their remaining release
+/// collapses to ~20 ms; held notes are never touched). Returns the number
+/// shed.
+#[no_mangle]
+pub extern "C" fn fm_synth_shed_voices(handle: *mut Fm6OpVoiceManager, count: i32) -> i32 {
+    match unsafe { handle.as_mut() } {
+        Some(s) => s.shed_quietest_release(count.max(0) as usize) as i32,
+        None => 0,
+    }
+}
+
+// --- FM Synth Batched Parameters ---
+
+// Dirty-mask bit positions for FmParamBlock (must match ossian19.h).
+// Bits 1-54 are the per-operator parameters, 9 per operator in
+// FmOpParams field order.
+pub const FM_BIT_ALGORITHM: u64 = 1 << 0;
+pub const FM_OP_BIT_BASE: u32 = 1;
+pub const FM_PARAMS_PER_OP: u32 = 9;
+pub const FM_BIT_FILTER_ENABLED: u64 = 1 << 55;
+pub const FM_BIT_FILTER_CUTOFF: u64 = 1 << 56;
+pub const FM_BIT_FILTER_RESONANCE: u64 = 1 << 57;
+pub const FM_BIT_VIBRATO_DEPTH: u64 = 1 << 58;
+pub const FM_BIT_VIBRATO_RATE: u64 = 1 << 59;
+pub const FM_BIT_MASTER_VOLUME: u64 = 1 << 60;
+
+const fn fm_op_bit(op: u32, param: u32) -> u64 {
+    1 << (FM_OP_BIT_BASE + op * FM_PARAMS_PER_OP + param)
+}
+
+/// Per-operator parameter set. Layout must match ossian19.h.
+#[repr(C)]
+pub struct FmOpParams {
+    pub ratio: f32,
+    pub level: f32,
+    pub detune: f32,
+    pub feedback: f32,
+    pub velocity_sens: f32,
+    pub attack: f32,
+    pub decay: f32,
+    pub sustain: f32,
+    pub release: f32,
+}
+
+/// Packed parameter set for the FM synth. Layout must match the C
+/// declaration in ossian19.h exactly (repr(C), no implicit reordering).
+#[repr(C)]
+pub struct FmParamBlock {
+    /// One bit per parameter (see FM_BIT_* constants). Fields whose bit is
+    /// clear are ignored; pass u64::MAX for a full push.
+    pub dirty_mask: u64,
+    pub algorithm: i32,
+    pub ops: [FmOpParams; 6],
+    pub filter_cutoff: f32,
+    pub filter_resonance: f32,
+    pub vibrato_depth: f32,
+    pub vibrato_rate: f32,
+    pub master_volume: f32,
+    pub filter_enabled: bool,
+}
+
+/// Apply a batch of parameters in a single call. The whole block is applied
+/// before the next sample is rendered, so an automation pass can never land
+/// mid-way through the 63-setter sequence.
+#[no_mangle]
+pub extern "C" fn fm_synth_apply_params(handle: *mut Fm6OpVoiceManager, params: *const FmParamBlock) {
+    let s = match unsafe { handle.as_mut() } {
+        Some(s) => s,
+        None => return,
+    };
+    let p = match unsafe { params.as_ref() } {
+        Some(p) => p,
+        None => return,
+    };
+    fm_apply_block(s, p, p.dirty_mask);
+}
+
+/// Apply a complete preset in one call, ignoring the block's dirty mask.
+/// When `kill_voices` is true, sounding voices are hard-stopped first so the
+/// old patch's release tails are not rendered with the new operator topology.
+#[no_mangle]
+pub extern "C" fn fm_synth_apply_preset(
+    handle: *mut Fm6OpVoiceManager,
+    params: *const FmParamBlock,
+    kill_voices: bool,
+) {
+    let s = match unsafe { handle.as_mut() } {
+        Some(s) => s,
+        None => return,
+    };
+    let p = match unsafe { params.as_ref() } {
+        Some(p) => p,
+        None => return,
+    };
+    if kill_voices {
+        s.panic();
+    }
+    fm_apply_block(s, p, u64::MAX);
+    s.snap_smoothed();
+}
+
+fn fm_apply_block(s: &mut Fm6OpVoiceManager, p: &FmParamBlock, mask: u64) {
+    if mask & FM_BIT_ALGORITHM != 0 {
+        s.set_algorithm(Dx7Algorithm::from_u8(p.algorithm as u8));
+    }
+
+    for op in 0..6u32 {
+        let o = &p.ops[op as usize];
+        let idx = op as usize;
+        if mask & fm_op_bit(op, 0) != 0 {
+            s.set_op_ratio(idx, o.ratio);
+        }
+        if mask & fm_op_bit(op, 1) != 0 {
+            s.set_op_level(idx, o.level);
+        }
+        if mask & fm_op_bit(op, 2) != 0 {
+            s.set_op_detune(idx, o.detune);
+        }
+        if mask & fm_op_bit(op, 3) != 0 {
+            s.set_op_feedback(idx, o.feedback);
+        }
+        if mask & fm_op_bit(op, 4) != 0 {
+            s.set_op_velocity_sens(idx, o.velocity_sens);
+        }
+        if mask & fm_op_bit(op, 5) != 0 {
+            s.set_op_attack(idx, o.attack);
+        }
+        if mask & fm_op_bit(op, 6) != 0 {
+            s.set_op_decay(idx, o.decay);
+        }
+        if mask & fm_op_bit(op, 7) != 0 {
+            s.set_op_sustain(idx, o.sustain);
+        }
+        if mask & fm_op_bit(op, 8) != 0 {
+            s.set_op_release(idx, o.release);
+        }
+    }
+
+    if mask & FM_BIT_FILTER_ENABLED != 0 {
+        s.set_filter_enabled(p.filter_enabled);
+    }
+    if mask & FM_BIT_FILTER_CUTOFF != 0 {
+        s.set_filter_cutoff(p.filter_cutoff);
+    }
+    if mask & FM_BIT_FILTER_RESONANCE != 0 {
+        s.set_filter_resonance(p.filter_resonance);
+    }
+    if mask & FM_BIT_VIBRATO_DEPTH != 0 {
+        s.set_vibrato_depth(p.vibrato_depth);
+    }
+    if mask & FM_BIT_VIBRATO_RATE != 0 {
+        s.set_vibrato_rate(p.vibrato_rate);
+    }
+    if mask & FM_BIT_MASTER_VOLUME != 0 {
+        s.set_master_volume(p.master_volume);
+    }
+}
+
+// ============================================================================
+// DRUM MACHINE FFI
+// ============================================================================
+
+// Sound and kit indices match the DrumSound / DrumKit enums in core
+// (and the DRUM_SOUND_* / DRUM_KIT_* constants in ossian19.h).
+
+/// Create a drum machine instance
+#[no_mangle]
+pub extern "C" fn drum_synth_create(sample_rate: f32) -> *mut DrumMachine {
+    Box::into_raw(Box::new(DrumMachine::new(sample_rate)))
+}
+
+/// Destroy a drum machine instance
+#[no_mangle]
+pub extern "C" fn drum_synth_destroy(handle: *mut DrumMachine) {
+    if !handle.is_null() {
+        unsafe { drop(Box::from_raw(handle)); }
+    }
+}
+
+/// Set sample rate
+#[no_mangle]
+pub extern "C" fn drum_synth_set_sample_rate(handle: *mut DrumMachine, sample_rate: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_sample_rate(sample_rate);
+    }
+}
+
+/// Select a kit (0=808, 1=909, 2=707, 3=CR-78, 4=LinnDrum)
+#[no_mangle]
+pub extern "C" fn drum_synth_set_kit(handle: *mut DrumMachine, kit: i32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_kit(DrumKit::from_u8(kit.clamp(0, 4) as u8));
+    }
+}
+
+/// Master volume (0.0-1.0)
+#[no_mangle]
+pub extern "C" fn drum_synth_set_master_volume(handle: *mut DrumMachine, volume: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.set_master_volume(volume);
+    }
+}
+
+/// Trigger a sound immediately (sound index 0-10, velocity 0.0-1.0).
+/// Out-of-range sound indices are ignored.
+#[no_mangle]
+pub extern "C" fn drum_synth_trigger(handle: *mut DrumMachine, sound: i32, velocity: f32) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        if let Some(sound) = u8::try_from(sound).ok().and_then(DrumSound::from_u8) {
+            s.trigger(sound, velocity);
+        }
+    }
+}
+
+/// Silence all ringing voices
+#[no_mangle]
+pub extern "C" fn drum_synth_all_notes_off(handle: *mut DrumMachine) {
+    if let Some(s) = unsafe { handle.as_mut() } {
+        s.all_notes_off();
+    }
+}
+
+/// Number of voices currently sounding
+#[no_mangle]
+pub extern "C" fn drum_synth_active_voices(handle: *mut DrumMachine) -> i32 {
+    match unsafe { handle.as_ref() } {
+        Some(s) => s.active_voice_count() as i32,
+        None => 0,
+    }
+}
+
+/// Render a mono block. All sounding voices render in one batched pass
+/// over the buffer, so cost per block is one traversal regardless of how
+/// many hits are ringing.
+#[no_mangle]
+pub extern "C" fn drum_synth_process(handle: *mut DrumMachine, out: *mut f32, num_samples: usize) {
+    if handle.is_null() || out.is_null() {
+        return;
+    }
+    let s = unsafe { &mut *handle };
+    let out_slice = unsafe { slice::from_raw_parts_mut(out, num_samples) };
+    s.process(out_slice);
+}
+
+/// Render with sample-accurate triggering. Events must be sorted by
+/// sample_offset; NOTE_ON events carry the drum sound index (0-10) in
+/// `data` and velocity in `value`. NOTE_OFF is meaningless for one-shot
+/// drums and is ignored; ALL_NOTES_OFF silences the pool.
+#[no_mangle]
+pub extern "C" fn drum_synth_process_events(
+    handle: *mut DrumMachine,
+    events: *const MidiEvent,
+    num_events: usize,
+    out: *mut f32,
+    num_samples: usize,
+) {
+    if handle.is_null() || out.is_null() {
+        return;
+    }
+    if events.is_null() && num_events > 0 {
+        return;
+    }
+
+    let s = unsafe { &mut *handle };
+    let out_slice = unsafe { slice::from_raw_parts_mut(out, num_samples) };
+    let events: &[MidiEvent] = if num_events == 0 {
+        &[]
+    } else {
+        unsafe { slice::from_raw_parts(events, num_events) }
+    };
+
+    let mut cursor = 0usize;
+    for event in events {
+        let offset = (event.sample_offset as usize).min(num_samples);
+        if offset > cursor {
+            s.process(&mut out_slice[cursor..offset]);
+            cursor = offset;
+        }
+        match event.kind {
+            MIDI_EVENT_NOTE_ON => {
+                if let Some(sound) = DrumSound::from_u8(event.data) {
+                    s.trigger(sound, event.value);
+                }
+            }
+            MIDI_EVENT_ALL_NOTES_OFF => s.all_notes_off(),
+            _ => {}
+        }
+    }
+    if cursor < num_samples {
+        s.process(&mut out_slice[cursor..]);
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//==============================================================================
+// Debug-buildable audit that catches heap allocation on the audio thread.
+//
+// Off by default: compile the plugin target with OSSIAN19_AUDIT_ALLOCATIONS=1
+// (debug builds only — the hooks cost one thread-local check per allocation
+// process-wide). Exactly one translation unit per target must additionally
+// define OSSIAN19_AUDIT_ALLOCATIONS_IMPL before including this header; that
+// TU emits the global operator new/delete replacements. The processors use
+// PluginProcessor.cpp for this.
+//
+// processBlock() declares a ScopedAudit at the top; any operator new while
+// the guard is alive trips a jassert (with the guard disarmed first, so the
+// debugger and the assert machinery may themselves allocate) and bumps a
+// counter that release-style soak tests can poll instead. Frees are not
+// flagged: dropping a buffer is cheap and sometimes unavoidable.
+
+#if OSSIAN19_AUDIT_ALLOCATIONS
+
+namespace allocation_audit
+{
+    // Armed only on the audio thread, only for the duration of processBlock()
+    inline thread_local bool armed = false;
+
+    inline std::atomic<int> violations { 0 };
+
+    struct ScopedAudit
+    {
+        ScopedAudit() noexcept  { armed = true; }
+        ~ScopedAudit() noexcept { armed = false; }
+    };
+
+    inline void check() noexcept
+    {
+        if (armed)
+        {
+            armed = false;
+            violations.fetch_add(1, std::memory_order_relaxed);
+            jassertfalse;  // heap allocation inside processBlock()
+            armed = true;
+        }
+    }
+}
+
+#if OSSIAN19_AUDIT_ALLOCATIONS_IMPL
+
+void* operator new(std::size_t size)
+{
+    allocation_audit::check();
+    if (void* p = std::malloc(size > 0 ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+#endif // OSSIAN19_AUDIT_ALLOCATIONS_IMPL
+
+#else
+
+namespace allocation_audit
+{
+    // No-op stand-in so call sites need no #if of their own
+    struct ScopedAudit
+    {
+        ScopedAudit() noexcept {}
+    };
+}
+
+#endif // OSSIAN19_AUDIT_ALLOCATIONS
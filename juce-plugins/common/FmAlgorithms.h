@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+//==============================================================================
+// FM Algorithm data (shared between the editor's AlgorithmDisplay and any
+// processor-side metadata lookups)
+//
+// Everything here is constexpr so the whole 32-algorithm table is baked into
+// .rodata at compile time — no static-init heap allocation on plugin load.
+//==============================================================================
+
+// Fixed-capacity operator list (an algorithm involves at most 6 operators).
+// Mirrors the minimal slice of the std::vector<int> interface the drawing
+// code uses.
+struct FmOpList
+{
+    std::array<int8_t, 6> ops;
+    int8_t count;
+
+    constexpr const int8_t* begin() const { return ops.data(); }
+    constexpr const int8_t* end() const { return ops.data() + count; }
+    constexpr size_t size() const { return static_cast<size_t>(count); }
+    constexpr bool empty() const { return count == 0; }
+    constexpr int8_t operator[](size_t i) const { return ops[i]; }
+};
+
+// Builds an FmOpList from a brace-style argument list, e.g. ops(1, 3, 5).
+template <typename... Ts>
+constexpr FmOpList ops(Ts... values)
+{
+    return { { static_cast<int8_t>(values)... },
+             static_cast<int8_t>(sizeof...(values)) };
+}
+
+struct FmAlgorithm
+{
+    // For each operator (0-5), list which operators it modulates (empty = carrier)
+    FmOpList modulatesTo[6];
+    // Which operator has feedback (−1 = none)
+    int8_t feedbackOp;
+    // Carriers (operators that output to audio)
+    FmOpList carriers;
+};
+
+//==============================================================================
+// All 32 DX7-style FM algorithms
+//==============================================================================
+inline constexpr std::array<FmAlgorithm, 32> FM_ALGORITHMS = { {
+    // ALG 1: Serial 1→2→3→4→5→6
+    { { ops(1), ops(2), ops(3), ops(4), ops(5), ops() }, 0, ops(5) },
+
+    // ALG 2: 1→2, 2→3→4→5→6
+    { { ops(1), ops(2), ops(3), ops(4), ops(5), ops() }, 1, ops(5) },
+
+    // ALG 3: 1→3, 2→3→4→5→6
+    { { ops(2), ops(2), ops(3), ops(4), ops(5), ops() }, 2, ops(5) },
+
+    // ALG 4: 1→2→3→4→5→6 with FB on 4
+    { { ops(1), ops(2), ops(3), ops(4), ops(5), ops() }, 3, ops(5) },
+
+    // ALG 5: 1→2, 3→4, 5→6
+    { { ops(1), ops(), ops(3), ops(), ops(5), ops() }, 0, ops(1, 3, 5) },
+
+    // ALG 6: 1→2, 3→4, 5→6 with FB on 5
+    { { ops(1), ops(), ops(3), ops(), ops(5), ops() }, 4, ops(1, 3, 5) },
+
+    // ALG 7: 1→2, 3→(4,5,6)
+    { { ops(1), ops(), ops(3, 4, 5), ops(), ops(), ops() }, 0, ops(1, 3, 4, 5) },
+
+    // ALG 8: 1→2, 3→4→(5,6)
+    { { ops(1), ops(), ops(3), ops(4, 5), ops(), ops() }, 3, ops(1, 4, 5) },
+
+    // ALG 9: 1→2, 3→4→5→6
+    { { ops(1), ops(), ops(3), ops(4), ops(5), ops() }, 1, ops(1, 5) },
+
+    // ALG 10: 3→(1,2), 4→5→6
+    { { ops(), ops(), ops(0, 1), ops(4), ops(5), ops() }, 2, ops(0, 1, 5) },
+
+    // ALG 11: 1→2, 3→(4→5→6)
+    { { ops(1), ops(), ops(3), ops(4), ops(5), ops() }, 2, ops(1, 5) },
+
+    // ALG 12: 1→2, 3→4, 5→6 (parallel pairs)
+    { { ops(1), ops(), ops(3), ops(), ops(5), ops() }, 1, ops(1, 3, 5) },
+
+    // ALG 13: 1→2, 3→(4,5,6)
+    { { ops(1), ops(), ops(3, 4, 5), ops(), ops(), ops() }, 2, ops(1, 3, 4, 5) },
+
+    // ALG 14: 1→2→(3,4,5,6)
+    { { ops(1), ops(2, 3, 4, 5), ops(), ops(), ops(), ops() }, 0, ops(2, 3, 4, 5) },
+
+    // ALG 15: 1→2, 3→4→(5,6)
+    { { ops(1), ops(), ops(3), ops(4, 5), ops(), ops() }, 0, ops(1, 4, 5) },
+
+    // ALG 16: 1→(2,3,4,5,6) - one modulator
+    { { ops(1, 2, 3, 4, 5), ops(), ops(), ops(), ops(), ops() }, 0, ops(1, 2, 3, 4, 5) },
+
+    // ALG 17: 1→(2,3), 4→5, 6
+    { { ops(1, 2), ops(), ops(), ops(4), ops(), ops() }, 0, ops(1, 2, 4, 5) },
+
+    // ALG 18: 1→2→3, 4→(5,6)
+    { { ops(1), ops(2), ops(), ops(4, 5), ops(), ops() }, 2, ops(2, 4, 5) },
+
+    // ALG 19: 1→2, 3→(4,5), 6
+    { { ops(1), ops(), ops(3, 4), ops(), ops(), ops() }, 0, ops(1, 3, 4, 5) },
+
+    // ALG 20: 1→2, 3→4, 5, 6
+    { { ops(1), ops(), ops(3), ops(), ops(), ops() }, 2, ops(1, 3, 4, 5) },
+
+    // ALG 21: 1→2, 3, 4, 5, 6 (mostly parallel)
+    { { ops(1), ops(), ops(), ops(), ops(), ops() }, 2, ops(1, 2, 3, 4, 5) },
+
+    // ALG 22: 1→(2,3,4,5), 6
+    { { ops(1, 2, 3, 4), ops(), ops(), ops(), ops(), ops() }, 0, ops(1, 2, 3, 4, 5) },
+
+    // ALG 23: 1→2, 3→(4,5), 6
+    { { ops(1), ops(), ops(3, 4), ops(), ops(), ops() }, 2, ops(1, 3, 4, 5) },
+
+    // ALG 24: 1→2, 3→4, 5, 6
+    { { ops(1), ops(), ops(3), ops(), ops(), ops() }, 5, ops(1, 3, 4, 5) },
+
+    // ALG 25: 1→2, 3, 4, 5, 6
+    { { ops(1), ops(), ops(), ops(), ops(), ops() }, 5, ops(1, 2, 3, 4, 5) },
+
+    // ALG 26: 3→(1,2), 6→(4,5)
+    { { ops(), ops(), ops(0, 1), ops(), ops(), ops(3, 4) }, 5, ops(0, 1, 3, 4) },
+
+    // ALG 27: 3→(1,2), 5→4, 6
+    { { ops(), ops(), ops(0, 1), ops(), ops(3), ops() }, 4, ops(0, 1, 3, 5) },
+
+    // ALG 28: 1→2→3, 4, 5→6
+    { { ops(1), ops(2), ops(), ops(), ops(5), ops() }, 0, ops(2, 3, 5) },
+
+    // ALG 29: 1→2, 3, 4→5, 6
+    { { ops(1), ops(), ops(), ops(4), ops(), ops() }, 0, ops(1, 2, 4, 5) },
+
+    // ALG 30: 1→2→3, 4→5, 6
+    { { ops(1), ops(2), ops(), ops(4), ops(), ops() }, 0, ops(2, 4, 5) },
+
+    // ALG 31: 1, 2, 3, 4, 5→6
+    { { ops(), ops(), ops(), ops(), ops(5), ops() }, 5, ops(0, 1, 2, 3, 5) },
+
+    // ALG 32: All carriers (parallel)
+    { { ops(), ops(), ops(), ops(), ops(), ops() }, 5, ops(0, 1, 2, 3, 4, 5) },
+} };
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+
+//==============================================================================
+// 2x half-band decimator for the oversampled render path.
+//
+// 31-tap windowed-sinc half-band FIR (Blackman window, ~79 dB stopband at
+// 0.35 fs). Every second tap is zero by construction, so only the centre tap
+// and 7 symmetric pairs are computed per output sample — a tight inner loop
+// the compiler vectorizes. Group delay is 7.5 samples at the decimated rate;
+// callers should report 8 samples of latency to the host.
+//==============================================================================
+class HalfBandDecimator
+{
+public:
+    // Group delay rounded up, at the decimated rate
+    static constexpr int kLatencySamples = 8;
+
+    void reset()
+    {
+        delay.fill(0.0f);
+        writeIndex = 0;
+    }
+
+    // Consumes numFramesOut * 2 input samples, writes numFramesOut samples.
+    // in and out may not alias.
+    void process(const float* in, float* out, int numFramesOut)
+    {
+        for (int i = 0; i < numFramesOut; ++i)
+        {
+            push(in[2 * i]);
+            push(in[2 * i + 1]);
+
+            float acc = kCentre * tap(15);
+            for (int j = 0; j < kNumPairs; ++j)
+                acc += kSide[j] * (tap(15 - kOffsets[j]) + tap(15 + kOffsets[j]));
+
+            out[i] = acc;
+        }
+    }
+
+private:
+    static constexpr int kNumPairs = 7;
+    static constexpr float kCentre = 0.500004637f;
+    static constexpr int kOffsets[kNumPairs] = { 1, 3, 5, 7, 9, 11, 13 };
+    static constexpr float kSide[kNumPairs] = {
+        0.312633322f, -0.090106922f, 0.040107418f, -0.017917030f,
+        0.007100857f, -0.002230286f, 0.000410323f
+    };
+
+    void push(float x)
+    {
+        delay[writeIndex] = x;
+        writeIndex = (writeIndex + 1) & kMask;
+    }
+
+    // k samples back from the most recent input
+    float tap(int k) const
+    {
+        return delay[(writeIndex - 1 - k) & kMask];
+    }
+
+    static constexpr int kMask = 31;       // power-of-two delay line
+    std::array<float, 32> delay {};
+    int writeIndex = 0;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+
+// Process-wide arbiter for engine render threads. Owned through a
+// juce::SharedResourcePointer, so every plugin instance in the process talks
+// to the same object: instances that can use the engine's worker pool
+// register here, and the machine's core budget is split evenly across them.
+// Without this, 40 instances on a big session would each size their pool as
+// if they were alone and oversubscribe the box with 40 sets of workers.
+//
+// Membership changes on prepare/release callbacks; the audio thread only
+// does one atomic generation read per block to notice that the budget was
+// re-split (see applyThreadBudget() in the processors).
+class RenderCoordinator
+{
+public:
+    RenderCoordinator()
+        : numCpus(juce::jmax(1, juce::SystemStats::getNumCpus())) {}
+
+    // An instance counts toward the split only while its prepared block size
+    // is large enough for the engine pool to engage (or it is bouncing
+    // offline). Bumping the generation tells every other instance to re-read
+    // its share at the next block.
+    void addPoolClient()
+    {
+        ++poolClients;
+        ++generation;
+    }
+
+    void removePoolClient()
+    {
+        --poolClients;
+        ++generation;
+    }
+
+    // Fair realtime share for one instance: everything but one core is
+    // divided across the registered instances, leaving the host's own audio
+    // thread somewhere to run. Capped at the engine's single-instance
+    // realtime limit so a lone instance behaves exactly as before.
+    int realtimeThreadsPerClient() const
+    {
+        const int clients = juce::jmax(1, poolClients.load());
+        return juce::jlimit(1, 4, juce::jmax(1, numCpus - 1) / clients);
+    }
+
+    // Offline bounces care about throughput alone, so the whole machine is
+    // on the table — but still split, since hosts render multi-track stems
+    // with several instances bouncing at once.
+    int offlineThreadsPerClient() const
+    {
+        const int clients = juce::jmax(1, poolClients.load());
+        return juce::jlimit(1, 8, numCpus / clients);
+    }
+
+    // Largest share either policy can ever hand one instance (the offline
+    // cap, as if it were alone). Engines grow their worker pool but never
+    // shrink it, so sizing for this at prepare time guarantees that the
+    // render-thread re-split poll only ever adjusts the split count and
+    // never has to spawn a thread on the audio path.
+    int maxThreadsPerClient() const
+    {
+        return juce::jlimit(1, 8, numCpus);
+    }
+
+    juce::uint32 currentGeneration() const { return generation.load(); }
+
+private:
+    const int numCpus;
+    std::atomic<int> poolClients { 0 };
+    std::atomic<juce::uint32> generation { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(RenderCoordinator)
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include "ossian19.h"
+
+//==============================================================================
+// Holder for the engine's process-wide lookup tables. Used through
+// juce::SharedResourcePointer in each processor constructor so the first
+// instance in a session pays the one-time table build and the rest share
+// the warm read-only memory.
+//==============================================================================
+struct SharedEngineTables
+{
+    SharedEngineTables() { ossian19_tables_init(); }
+};
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+
+//==============================================================================
+// One block's worth of render telemetry, pushed by the audio thread at the
+// end of processBlock() and drained by the editor's timer.
+struct TelemetryFrame
+{
+    float renderTimeMs = 0.0f;    // wall time spent inside processBlock()
+    float blockDurationMs = 0.0f; // real-time budget for the block
+    float peakLeft = 0.0f;
+    float peakRight = 0.0f;
+    int activeVoices = 0;
+};
+
+//==============================================================================
+// Fixed-size single-producer/single-consumer ring on juce::AbstractFifo.
+// push() is wait-free and allocation-free; frames are simply dropped if the
+// ring fills up while no editor is open. drain() runs on the message thread.
+class TelemetryRing
+{
+public:
+    static constexpr int capacity = 256;
+
+    void push(const TelemetryFrame& frame) noexcept
+    {
+        const auto scope = fifo.write(1);
+        if (scope.blockSize1 > 0)
+            frames[(size_t) scope.startIndex1] = frame;
+    }
+
+    // Copies pending frames (oldest first) into dest, returns the count
+    int drain(TelemetryFrame* dest, int maxFrames) noexcept
+    {
+        const auto scope = fifo.read(juce::jmin(maxFrames, fifo.getNumReady()));
+        int count = 0;
+        for (int i = 0; i < scope.blockSize1; ++i)
+            dest[count++] = frames[(size_t) (scope.startIndex1 + i)];
+        for (int i = 0; i < scope.blockSize2; ++i)
+            dest[count++] = frames[(size_t) (scope.startIndex2 + i)];
+        return count;
+    }
+
+private:
+    juce::AbstractFifo fifo { capacity };
+    std::array<TelemetryFrame, capacity> frames {};
+};
+
+//==============================================================================
+// Compact CPU / voice-count / peak readout fed by a TelemetryRing. The CPU
+// bar shows the worst block of each drained batch as a fraction of the
+// real-time budget, so a single expensive instance stands out immediately.
+class TelemetryMeter : public juce::Component,
+                       private juce::Timer
+{
+public:
+    explicit TelemetryMeter(TelemetryRing& ringToDrain)
+        : ring(ringToDrain)
+    {
+        setInterceptsMouseClicks(false, false);
+        startTimerHz(30);
+    }
+
+    void paint(juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat();
+        g.setColour(juce::Colour(0xff1a1a1a));
+        g.fillRoundedRectangle(bounds, 4.0f);
+        g.setColour(juce::Colour(0xff444444));
+        g.drawRoundedRectangle(bounds.reduced(0.5f), 4.0f, 1.0f);
+
+        auto inner = bounds.reduced(6.0f);
+        auto barArea = inner.removeFromTop(8.0f);
+        g.setColour(juce::Colour(0xff333333));
+        g.fillRoundedRectangle(barArea, 2.0f);
+
+        const float fill = juce::jlimit(0.0f, 1.0f, cpuFraction);
+        const juce::Colour barColor = fill > 0.85f ? juce::Colour(0xffff4444)
+                                    : fill > 0.6f  ? juce::Colour(0xffffcc00)
+                                                   : juce::Colour(0xff7cff64);
+        g.setColour(barColor);
+        g.fillRoundedRectangle(barArea.withWidth(barArea.getWidth() * fill), 2.0f);
+
+        g.setColour(juce::Colour(0xff999999));
+        g.setFont(juce::FontOptions(11.0f));
+        g.drawText(juce::String::formatted("CPU %4.1f%%   %d voices   %4.1f dB",
+                                           cpuFraction * 100.0f, voices, peakDb),
+                   inner.toNearestInt(), juce::Justification::centredLeft);
+    }
+
+private:
+    void timerCallback() override
+    {
+        const int count = ring.drain(scratch.data(), (int) scratch.size());
+        if (count == 0)
+            return;
+
+        // The worst block of the batch drives the CPU meter; peaks decay
+        // slowly so short transients stay readable
+        float worst = 0.0f;
+        float peak = 0.0f;
+        for (int i = 0; i < count; ++i)
+        {
+            const auto& frame = scratch[(size_t) i];
+            if (frame.blockDurationMs > 0.0f)
+                worst = juce::jmax(worst, frame.renderTimeMs / frame.blockDurationMs);
+            peak = juce::jmax(peak, frame.peakLeft, frame.peakRight);
+        }
+        cpuFraction = cpuFraction * 0.6f + worst * 0.4f;
+        peakLinear = juce::jmax(peak, peakLinear * 0.85f);
+        peakDb = juce::Decibels::gainToDecibels(peakLinear, -60.0f);
+        voices = scratch[(size_t) (count - 1)].activeVoices;
+        repaint();
+    }
+
+    TelemetryRing& ring;
+    std::array<TelemetryFrame, TelemetryRing::capacity> scratch {};
+    float cpuFraction = 0.0f;
+    float peakLinear = 0.0f;
+    float peakDb = -60.0f;
+    int voices = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TelemetryMeter)
+};
@@ -0,0 +1,161 @@
+// Headless benchmark for the OSSIAN-19 engines.
+//
+// Links libossian19_ffi.a directly (no JUCE) and renders scripted note
+// patterns through fm_synth_process / sub_synth_process, sweeping all 32
+// FM algorithms, buffer sizes 32-2048 and polyphony 1-32. Reports average
+// ns/sample and the worst single-block render time, so engine changes can
+// be gated on before/after numbers instead of gut feeling.
+
+#include "ossian19.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+
+constexpr float kSampleRate = 48000.0f;
+constexpr double kRenderSeconds = 1.0;
+
+struct BenchResult
+{
+    double nsPerSample = 0.0;
+    double worstBlockUs = 0.0;
+};
+
+// Renders kRenderSeconds of audio in blockSize chunks through processBlock,
+// retriggering the note pattern twice a second via retrigger so the run
+// covers attack transients as well as steady-state sustain.
+template <typename ProcessBlock, typename Retrigger>
+BenchResult measure(int blockSize, ProcessBlock&& processBlock, Retrigger&& retrigger)
+{
+    std::vector<float> left(static_cast<size_t>(blockSize), 0.0f);
+    std::vector<float> right(static_cast<size_t>(blockSize), 0.0f);
+
+    const long totalBlocks = static_cast<long>(kSampleRate * kRenderSeconds) / blockSize;
+    const long blocksPerRetrigger = static_cast<long>(kSampleRate * 0.5) / blockSize;
+
+    retrigger();
+
+    // Warm up: let envelopes leave the initial attack and caches fill
+    for (int i = 0; i < 4; ++i)
+        processBlock(left.data(), right.data(), static_cast<size_t>(blockSize));
+
+    BenchResult result;
+    double totalNs = 0.0;
+
+    for (long block = 0; block < totalBlocks; ++block)
+    {
+        if (blocksPerRetrigger > 0 && block % blocksPerRetrigger == 0)
+            retrigger();
+
+        const auto start = std::chrono::steady_clock::now();
+        processBlock(left.data(), right.data(), static_cast<size_t>(blockSize));
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        totalNs += ns;
+        result.worstBlockUs = std::max(result.worstBlockUs, ns / 1000.0);
+    }
+
+    result.nsPerSample = totalNs / (static_cast<double>(totalBlocks) * blockSize);
+    return result;
+}
+
+// A poly-note chord spread across the keyboard, C3 upward in fourths
+void fmChord(FmSynthHandle synth, int poly)
+{
+    for (int i = 0; i < poly; ++i)
+        fm_synth_note_on(synth, static_cast<uint8_t>(48 + (i * 5) % 36), 0.8f);
+}
+
+void subChord(SubSynthHandle synth, int poly)
+{
+    for (int i = 0; i < poly; ++i)
+        sub_synth_note_on(synth, static_cast<uint8_t>(48 + (i * 5) % 36), 0.8f);
+}
+
+BenchResult benchFm(int algorithm, int poly, int blockSize)
+{
+    FmSynthHandle synth = fm_synth_create(kSampleRate);
+    fm_synth_set_algorithm(synth, algorithm);
+    fm_synth_set_max_polyphony(synth, poly);
+
+    const BenchResult result = measure(
+        blockSize,
+        [synth](float* left, float* right, size_t n) { fm_synth_process(synth, left, right, n); },
+        [synth, poly]() { fmChord(synth, poly); });
+
+    fm_synth_destroy(synth);
+    return result;
+}
+
+BenchResult benchSub(int poly, int blockSize)
+{
+    SubSynthHandle synth = sub_synth_create(kSampleRate);
+    sub_synth_set_max_polyphony(synth, poly);
+
+    const BenchResult result = measure(
+        blockSize,
+        [synth](float* left, float* right, size_t n) { sub_synth_process(synth, left, right, n); },
+        [synth, poly]() { subChord(synth, poly); });
+
+    sub_synth_destroy(synth);
+    return result;
+}
+
+void printRow(const char* label, const BenchResult& result)
+{
+    std::printf("  %-32s %10.1f ns/sample %12.1f us worst block\n",
+                label, result.nsPerSample, result.worstBlockUs);
+}
+
+} // namespace
+
+int main()
+{
+    char label[64];
+
+    std::printf("OSSIAN-19 engine benchmark (%.0f Hz, %.0fs per run)\n\n",
+                kSampleRate, kRenderSeconds);
+
+    std::printf("FM: all 32 algorithms (8 voices, 512-sample blocks)\n");
+    for (int algo = 0; algo < 32; ++algo)
+    {
+        std::snprintf(label, sizeof(label), "algorithm %d", algo + 1);
+        printRow(label, benchFm(algo, 8, 512));
+    }
+
+    std::printf("\nFM: polyphony sweep (algorithm 1, 512-sample blocks)\n");
+    for (int poly : {1, 2, 4, 8, 16, 24, 32})
+    {
+        std::snprintf(label, sizeof(label), "%d voices", poly);
+        printRow(label, benchFm(0, poly, 512));
+    }
+
+    std::printf("\nFM: buffer-size sweep (algorithm 1, 8 voices)\n");
+    for (int blockSize : {32, 64, 128, 256, 512, 1024, 2048})
+    {
+        std::snprintf(label, sizeof(label), "%d-sample blocks", blockSize);
+        printRow(label, benchFm(0, 8, blockSize));
+    }
+
+    std::printf("\nSub: polyphony sweep (512-sample blocks)\n");
+    for (int poly : {1, 2, 4, 8, 16, 24, 32})
+    {
+        std::snprintf(label, sizeof(label), "%d voices", poly);
+        printRow(label, benchSub(poly, 512));
+    }
+
+    std::printf("\nSub: buffer-size sweep (8 voices)\n");
+    for (int blockSize : {32, 64, 128, 256, 512, 1024, 2048})
+    {
+        std::snprintf(label, sizeof(label), "%d-sample blocks", blockSize);
+        printRow(label, benchSub(8, blockSize));
+    }
+
+    return 0;
+}
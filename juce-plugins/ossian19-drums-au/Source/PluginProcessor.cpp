@@ -0,0 +1,184 @@
+#include "PluginProcessor.h"
+
+Ossian19DrumsProcessor::Ossian19DrumsProcessor()
+    : AudioProcessor(BusesProperties()
+          .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
+      parameters(*this, nullptr, "OSSIAN19_DRUMS_PARAMS", createParameterLayout())
+{
+    midiEvents.reserve(1024);
+}
+
+Ossian19DrumsProcessor::~Ossian19DrumsProcessor()
+{
+    if (synthHandle)
+    {
+        drum_synth_destroy(synthHandle);
+        synthHandle = nullptr;
+    }
+}
+
+juce::AudioProcessorValueTreeState::ParameterLayout Ossian19DrumsProcessor::createParameterLayout()
+{
+    std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
+
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { KIT, 1 }, "Kit",
+        juce::StringArray { "TR-808", "TR-909", "TR-707", "CR-78", "LinnDrum" }, 0));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { MASTER_VOL, 1 }, "Master Volume",
+        juce::NormalisableRange<float>(0.0f, 1.0f), 0.8f));
+
+    return { params.begin(), params.end() };
+}
+
+int Ossian19DrumsProcessor::soundForMidiNote(int note)
+{
+    // General MIDI percussion map, folded onto the eleven engine sounds
+    switch (note)
+    {
+        case 35: case 36: return DRUM_SOUND_KICK;
+        case 37:          return DRUM_SOUND_RIMSHOT;
+        case 38: case 40: return DRUM_SOUND_SNARE;
+        case 39:          return DRUM_SOUND_CLAP;
+        case 42: case 44: return DRUM_SOUND_HIHAT_CLOSED;
+        case 46:          return DRUM_SOUND_HIHAT_OPEN;
+        case 41: case 43: return DRUM_SOUND_TOM_LOW;
+        case 45: case 47: return DRUM_SOUND_TOM_MID;
+        case 48: case 50: return DRUM_SOUND_TOM_HI;
+        case 49: case 51: case 57: return DRUM_SOUND_CYMBAL;
+        case 56:          return DRUM_SOUND_COWBELL;
+        default:          return -1;
+    }
+}
+
+void Ossian19DrumsProcessor::prepareToPlay(double sampleRate, int /*samplesPerBlock*/)
+{
+    if (!synthHandle)
+        synthHandle = drum_synth_create(static_cast<float>(sampleRate));
+    else
+        drum_synth_set_sample_rate(synthHandle, static_cast<float>(sampleRate));
+
+    // Force a parameter push on the first block after (re)preparing
+    lastKit = -1.0f;
+    lastVolume = -1.0f;
+}
+
+void Ossian19DrumsProcessor::releaseResources()
+{
+    if (synthHandle)
+        drum_synth_all_notes_off(synthHandle);
+}
+
+void Ossian19DrumsProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ScopedNoDenormals noDenormals;
+
+    if (!synthHandle)
+    {
+        buffer.clear();
+        return;
+    }
+
+    const float kit = *parameters.getRawParameterValue(KIT);
+    if (kit != lastKit)
+    {
+        drum_synth_set_kit(synthHandle, static_cast<int32_t>(kit));
+        lastKit = kit;
+    }
+    const float volume = *parameters.getRawParameterValue(MASTER_VOL);
+    if (volume != lastVolume)
+    {
+        drum_synth_set_master_volume(synthHandle, volume);
+        lastVolume = volume;
+    }
+
+    // Convert MIDI to sample-accurate engine events. Note-offs are dropped
+    // here rather than in the engine: drum voices are one-shot.
+    midiEvents.clear();
+    for (const auto metadata : midiMessages)
+    {
+        auto message = metadata.getMessage();
+
+        MidiEvent event {};
+        event.sample_offset = static_cast<uint32_t>(juce::jmax(0, metadata.samplePosition));
+        event.channel = static_cast<uint8_t>(juce::jmax(0, message.getChannel() - 1));
+
+        if (message.isNoteOn())
+        {
+            const int sound = soundForMidiNote(message.getNoteNumber());
+            if (sound < 0)
+                continue;
+            event.kind = MIDI_EVENT_NOTE_ON;
+            event.data = static_cast<uint8_t>(sound);
+            event.value = message.getFloatVelocity();
+        }
+        else if (message.isAllNotesOff() || message.isAllSoundOff())
+        {
+            event.kind = MIDI_EVENT_ALL_NOTES_OFF;
+        }
+        else
+        {
+            continue;
+        }
+
+        midiEvents.push_back(event);
+    }
+
+    // One engine call renders every sounding voice in a single batched pass
+    // over the buffer; the mono mix is duplicated to the other channels.
+    auto* leftChannel = buffer.getWritePointer(0);
+    drum_synth_process_events(synthHandle, midiEvents.data(), midiEvents.size(),
+                              leftChannel, static_cast<size_t>(buffer.getNumSamples()));
+
+    for (int ch = 1; ch < buffer.getNumChannels(); ++ch)
+        buffer.copyFrom(ch, 0, leftChannel, buffer.getNumSamples());
+}
+
+juce::AudioProcessorEditor* Ossian19DrumsProcessor::createEditor()
+{
+    // Two parameters don't justify a bespoke UI; the generic editor exposes
+    // kit selection and volume directly from the APVTS.
+    return new juce::GenericAudioProcessorEditor(*this);
+}
+
+void Ossian19DrumsProcessor::getStateInformation(juce::MemoryBlock& destData)
+{
+    // Versioned little-endian binary blob, same scheme as the Sub/FM plugins
+    juce::MemoryOutputStream out(destData, false);
+    const auto& params = getParameters();
+
+    out.writeInt(kStateMagic);
+    out.writeInt(kStateVersion);
+    out.writeInt(params.size());
+    for (auto* param : params)
+        out.writeFloat(param->getValue());
+}
+
+void Ossian19DrumsProcessor::setStateInformation(const void* data, int sizeInBytes)
+{
+    juce::MemoryInputStream in(data, static_cast<size_t>(sizeInBytes), false);
+
+    if (sizeInBytes < 12 || in.readInt() != kStateMagic)
+        return;
+    if (in.readInt() > kStateVersion)
+        return; // written by a newer build; don't guess
+
+    const int count = in.readInt();
+    const auto& params = getParameters();
+    for (int i = 0; i < count && !in.isExhausted(); ++i)
+    {
+        const float value = in.readFloat();
+        if (i < params.size())
+            params[i]->setValueNotifyingHost(value);
+    }
+
+    // Re-push everything on the next block
+    lastKit = -1.0f;
+    lastVolume = -1.0f;
+}
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    return new Ossian19DrumsProcessor();
+}
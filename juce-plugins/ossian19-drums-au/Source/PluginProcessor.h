@@ -0,0 +1,69 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <vector>
+#include "ossian19.h"
+#include "SharedEngineTables.h"
+
+class Ossian19DrumsProcessor : public juce::AudioProcessor
+{
+public:
+    Ossian19DrumsProcessor();
+    ~Ossian19DrumsProcessor() override;
+
+    void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    juce::AudioProcessorEditor* createEditor() override;
+    bool hasEditor() const override { return true; }
+
+    const juce::String getName() const override { return "OSSIAN-19 Drums"; }
+    bool acceptsMidi() const override { return true; }
+    bool producesMidi() const override { return false; }
+    double getTailLengthSeconds() const override { return 0.0; }
+
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const juce::String getProgramName(int) override { return {}; }
+    void changeProgramName(int, const juce::String&) override {}
+
+    void getStateInformation(juce::MemoryBlock& destData) override;
+    void setStateInformation(const void* data, int sizeInBytes) override;
+
+    juce::AudioProcessorValueTreeState& getValueTreeState() { return parameters; }
+
+private:
+    // Declared before synthHandle so the shared tables exist by the time
+    // drum_synth_create runs; the first instance builds them, the rest share
+    juce::SharedResourcePointer<SharedEngineTables> sharedTables;
+
+    DrumSynthHandle synthHandle = nullptr;
+    juce::AudioProcessorValueTreeState parameters;
+
+    // Parameter IDs
+    static constexpr const char* KIT = "kit";
+    static constexpr const char* MASTER_VOL = "master_vol";
+
+    // Binary state blob: "O19D" magic, version, then the normalized
+    // parameter values packed in layout order (little-endian throughout)
+    static constexpr int kStateMagic = 0x4F313944;  // "O19D"
+    static constexpr int kStateVersion = 1;
+
+    // With only two engine parameters, both cheap idempotent setters, a
+    // dirty mask buys nothing here: the values are pushed at block start.
+    float lastKit = -1.0f;
+    float lastVolume = -1.0f;
+
+    // Scratch buffer for sample-accurate event scheduling (reserved up
+    // front so processBlock() normally does not allocate)
+    std::vector<MidiEvent> midiEvents;
+
+    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+
+    // General MIDI percussion note -> DRUM_SOUND_* index, or -1 if unmapped
+    static int soundForMidiNote(int note);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Ossian19DrumsProcessor)
+};
@@ -15,29 +15,31 @@ void AlgorithmDisplay::setAlgorithm(int algoIndex)
     }
 }
 
-std::array<AlgorithmDisplay::OpPosition, 6> AlgorithmDisplay::calculateLayout(
-    const FmAlgorithm& algo, float width, float height)
+namespace
 {
-    std::array<OpPosition, 6> positions;
-    std::set<int> carrierSet(algo.carriers.begin(), algo.carriers.end());
 
+// Every padding/spacing constant in the layout is a fraction of the drawing
+// area, so operator positions are pure fractions too and can be derived once
+// per algorithm at compile time instead of re-walking the modulation graph
+// on every re-rasterize.
+struct NormalizedPos { float x, y; };
+struct NormalizedLayout { NormalizedPos pos[6]; };
+
+constexpr NormalizedLayout computeLayout(const FmAlgorithm& algo)
+{
     // Level-based layout: calculate distance from carrier for each operator
     // Carriers are level 0, their modulators are level 1, etc.
-    std::array<int, 6> level = {-1, -1, -1, -1, -1, -1};
+    int level[6] = {-1, -1, -1, -1, -1, -1};
 
     // Start with carriers at level 0
     for (int c : algo.carriers)
-    {
         level[c] = 0;
-    }
 
     // Iteratively assign levels to modulators
     bool changed = true;
-    int iterations = 0;
-    while (changed && iterations < 10)
+    for (int iterations = 0; changed && iterations < 10; ++iterations)
     {
         changed = false;
-        iterations++;
         for (int i = 0; i < 6; ++i)
         {
             if (level[i] >= 0) continue;  // already assigned
@@ -45,15 +47,10 @@ std::array<AlgorithmDisplay::OpPosition, 6> AlgorithmDisplay::calculateLayout(
             // Check if we modulate anyone with a known level
             for (int target : algo.modulatesTo[i])
             {
-                int targetLevel = level[target];
-                if (targetLevel >= 0)
+                if (level[target] >= 0 && level[target] + 1 > level[i])
                 {
-                    int newLevel = targetLevel + 1;
-                    if (level[i] < 0 || newLevel > level[i])
-                    {
-                        level[i] = newLevel;
-                        changed = true;
-                    }
+                    level[i] = level[target] + 1;
+                    changed = true;
                 }
             }
         }
@@ -61,86 +58,65 @@ std::array<AlgorithmDisplay::OpPosition, 6> AlgorithmDisplay::calculateLayout(
 
     // Assign level 0 to any unassigned operators (shouldn't happen)
     for (int i = 0; i < 6; ++i)
-    {
         if (level[i] < 0) level[i] = 0;
-    }
 
     // Find max level
     int maxLevel = 0;
     for (int i = 0; i < 6; ++i)
-    {
         if (level[i] > maxLevel) maxLevel = level[i];
-    }
 
-    // Group operators by level
-    std::vector<std::vector<int>> byLevel(maxLevel + 1);
+    // Group operators by level; walking 0..5 keeps each group in op order
+    int byLevel[6][6] = {};
+    int byLevelCount[6] = {};
     for (int i = 0; i < 6; ++i)
-    {
-        byLevel[level[i]].push_back(i);
-    }
+        byLevel[level[i]][byLevelCount[level[i]]++] = i;
 
-    // Sort operators within each level
-    for (auto& ops : byLevel)
-    {
-        std::sort(ops.begin(), ops.end());
-    }
+    // Proportional padding (fractions of the drawing area)
+    constexpr float paddingX = 0.08f;        // 8% of width
+    constexpr float paddingTop = 0.15f;      // 15% for title area
+    constexpr float paddingBottom = 0.12f;   // 12% for output line
+    constexpr float availableHeight = 1.0f - paddingTop - paddingBottom;
+    constexpr float availableWidth = 1.0f - paddingX * 2.0f;
+    constexpr float minBallSpacing = 0.20f;  // 20% of height minimum between balls
 
-    // Calculate positions - proportional padding for any size
-    float paddingX = width * 0.08f;  // 8% of width
-    float paddingTop = height * 0.15f;   // 15% for title area
-    float paddingBottom = height * 0.12f; // 12% for output line
-    float availableHeight = height - paddingTop - paddingBottom;
-    float availableWidth = width - paddingX * 2.0f;
+    NormalizedLayout layout {};
 
-    float minBallSpacing = height * 0.20f;  // 20% of height minimum between balls
-
-    // Check if we need zigzag layout for long single chains
-    bool needsZigzag = maxLevel >= 4 && algo.carriers.size() == 1;
-
-    if (needsZigzag)
+    // Long single chains get a zigzag layout split into 2 rows
+    if (maxLevel >= 4 && algo.carriers.size() == 1)
     {
-        // Zigzag layout: split into 2 rows
-        int midLevel = (maxLevel + 1) / 2;  // Same as Math.ceil(maxLevel / 2)
-        float topRowY = paddingTop + availableHeight * 0.25f;
-        float bottomRowY = paddingTop + availableHeight * 0.75f;
+        const int midLevel = (maxLevel + 1) / 2;  // Same as Math.ceil(maxLevel / 2)
+        const float topRowY = paddingTop + availableHeight * 0.25f;
+        const float bottomRowY = paddingTop + availableHeight * 0.75f;
 
         // Count ops in each row
         int topRowCount = 0;
         int bottomRowCount = 0;
         for (int lvl = 0; lvl <= maxLevel; ++lvl)
         {
-            if (lvl > midLevel) topRowCount += (int)byLevel[lvl].size();
-            else bottomRowCount += (int)byLevel[lvl].size();
+            if (lvl > midLevel) topRowCount += byLevelCount[lvl];
+            else bottomRowCount += byLevelCount[lvl];
         }
 
-        // Position operators
+        // Position operators: top row left to right, then continue on the
+        // bottom row
         int topIdx = 0;
         int bottomIdx = 0;
 
         for (int lvl = maxLevel; lvl >= 0; --lvl)
         {
-            const auto& ops = byLevel[lvl];
-            if (ops.empty()) continue;
-
-            if (lvl > midLevel)
+            for (int j = 0; j < byLevelCount[lvl]; ++j)
             {
-                // Top row - left to right
-                float spacing = availableWidth / (float)(topRowCount + 1);
-                for (int op : ops)
+                const int op = byLevel[lvl][j];
+                if (lvl > midLevel)
                 {
-                    float x = paddingX + spacing * (float)(topIdx + 1);
-                    positions[op] = { x, topRowY };
+                    const float spacing = availableWidth / (float)(topRowCount + 1);
+                    layout.pos[op] = { paddingX + spacing * (float)(topIdx + 1), topRowY };
                     topIdx++;
                 }
-            }
-            else
-            {
-                // Bottom row - continue going right
-                float spacing = availableWidth / (float)(bottomRowCount + 1);
-                for (int op : ops)
+                else
                 {
-                    float x = paddingX + spacing * (float)(bottomIdx + 1);
-                    positions[op] = { x, bottomRowY };
+                    const float spacing = availableWidth / (float)(bottomRowCount + 1);
+                    layout.pos[op] = { paddingX + spacing * (float)(bottomIdx + 1), bottomRowY };
                     bottomIdx++;
                 }
             }
@@ -149,40 +125,43 @@ std::array<AlgorithmDisplay::OpPosition, 6> AlgorithmDisplay::calculateLayout(
     else
     {
         // Standard level-based layout (works well for short chains)
-        int numRows = maxLevel + 1;
-        float idealRowHeight = availableHeight / (float)numRows;
-        float rowHeight = std::max(idealRowHeight, minBallSpacing);
+        const int numRows = maxLevel + 1;
+        const float idealRowHeight = availableHeight / (float)numRows;
+        const float rowHeight = idealRowHeight > minBallSpacing ? idealRowHeight : minBallSpacing;
 
         // Adjust starting Y if rows would overflow, otherwise center
-        float totalRowsHeight = rowHeight * (float)numRows;
-        float startY = (totalRowsHeight > availableHeight)
+        const float totalRowsHeight = rowHeight * (float)numRows;
+        const float startY = (totalRowsHeight > availableHeight)
             ? paddingTop
             : paddingTop + (availableHeight - totalRowsHeight) / 2.0f + rowHeight / 2.0f;
 
-        // Position operators
         for (int lvl = 0; lvl <= maxLevel; ++lvl)
         {
-            const auto& ops = byLevel[lvl];
-            if (ops.empty()) continue;
-
             // Y position: higher levels at top, carriers (level 0) at bottom
-            float y = startY + (float)(maxLevel - lvl) * rowHeight;
+            const float y = startY + (float)(maxLevel - lvl) * rowHeight;
 
             // X positions: spread evenly across width
-            float spacing = availableWidth / (float)(ops.size() + 1);
+            const float spacing = availableWidth / (float)(byLevelCount[lvl] + 1);
 
-            for (size_t i = 0; i < ops.size(); ++i)
-            {
-                int op = ops[i];
-                float x = paddingX + spacing * (float)(i + 1);
-                positions[op] = { x, y };
-            }
+            for (int j = 0; j < byLevelCount[lvl]; ++j)
+                layout.pos[byLevel[lvl][j]] = { paddingX + spacing * (float)(j + 1), y };
         }
     }
 
-    return positions;
+    return layout;
 }
 
+// All 32 operator layouts, baked into .rodata alongside FM_ALGORITHMS
+constexpr std::array<NormalizedLayout, 32> ALGORITHM_LAYOUTS = []
+{
+    std::array<NormalizedLayout, 32> table {};
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = computeLayout(FM_ALGORITHMS[i]);
+    return table;
+}();
+
+} // namespace
+
 void AlgorithmDisplay::drawOperator(juce::Graphics& g, int op, float x, float y,
                                      float radius, bool isCarrier)
 {
@@ -327,7 +306,29 @@ juce::String AlgorithmDisplay::buildDescriptionText(const FmAlgorithm& algo)
 
 void AlgorithmDisplay::paint(juce::Graphics& g)
 {
-    auto bounds = getLocalBounds().toFloat();
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const int imageW = juce::roundToInt((float) getWidth() * scale);
+    const int imageH = juce::roundToInt((float) getHeight() * scale);
+
+    if (cachedAlgo != currentAlgo || cachedScale != scale
+        || cachedImage.getWidth() != imageW || cachedImage.getHeight() != imageH)
+    {
+        cachedImage = juce::Image(juce::Image::ARGB,
+                                  juce::jmax(1, imageW), juce::jmax(1, imageH), true);
+        juce::Graphics imageContext(cachedImage);
+        imageContext.addTransform(juce::AffineTransform::scale(scale));
+        renderAlgorithm(imageContext, (float) getWidth(), (float) getHeight());
+
+        cachedAlgo = currentAlgo;
+        cachedScale = scale;
+    }
+
+    g.drawImageTransformed(cachedImage, juce::AffineTransform::scale(1.0f / scale));
+}
+
+void AlgorithmDisplay::renderAlgorithm(juce::Graphics& g, float width, float height)
+{
+    juce::Rectangle<float> bounds(0.0f, 0.0f, width, height);
 
     // LCD-style background
     g.setColour(juce::Colour(0xff151515));
@@ -350,13 +351,19 @@ void AlgorithmDisplay::paint(juce::Graphics& g)
                bounds.removeFromTop(24.0f),
                juce::Justification::centred);
 
-    // Calculate layout - use most of the space
+    // Layout - use most of the space. Positions come from the compile-time
+    // table as fractions of the drawing area, scaled to the current size.
     float displayWidth = bounds.getWidth();
     float displayHeight = bounds.getHeight();
     float offsetX = bounds.getX();
     float offsetY = bounds.getY();
 
-    auto positions = calculateLayout(algo, displayWidth, displayHeight);
+    const NormalizedLayout& norm = ALGORITHM_LAYOUTS[(size_t)currentAlgo];
+    struct OpPosition { float x, y; };
+    std::array<OpPosition, 6> positions;
+    for (int i = 0; i < 6; ++i)
+        positions[(size_t)i] = { norm.pos[i].x * displayWidth,
+                                 norm.pos[i].y * displayHeight };
 
     // Determine carriers
     std::set<int> carrierSet(algo.carriers.begin(), algo.carriers.end());
@@ -120,6 +120,88 @@ void OperatorPanel::resized()
     release->setBounds(x + (adsrW + gap) * 3, y, adsrW, adsrH);
 }
 
+//==============================================================================
+// AlgorithmSelector
+//==============================================================================
+void AlgorithmSelector::setSelected(int algoIndex)
+{
+    if (algoIndex >= 0 && algoIndex < 32 && algoIndex != selected)
+    {
+        selected = algoIndex;
+        repaint();
+    }
+}
+
+juce::Rectangle<int> AlgorithmSelector::cellBounds(int index) const
+{
+    const int gap = 2;
+    const int cellW = (getWidth() - 15 * gap) / 16;
+    const int cellH = (getHeight() - gap) / 2;
+    const int row = index / 16;
+    const int col = index % 16;
+    return { col * (cellW + gap), row * (cellH + gap), cellW, cellH };
+}
+
+int AlgorithmSelector::cellAt(juce::Point<int> pos) const
+{
+    for (int i = 0; i < 32; ++i)
+        if (cellBounds(i).contains(pos))
+            return i;
+    return -1;
+}
+
+void AlgorithmSelector::paint(juce::Graphics& g)
+{
+    // Same palette the old TextButtons used
+    const juce::Colour cellOff(0xff252525);
+    const juce::Colour cellOn(0xffffcc00);
+    const juce::Colour textOff(0xff888888);
+
+    g.setFont(juce::FontOptions(12.0f));
+
+    for (int i = 0; i < 32; ++i)
+    {
+        const auto cell = cellBounds(i).toFloat();
+        const bool isSelected = i == selected;
+
+        auto fill = isSelected ? cellOn : cellOff;
+        if (i == hovered && !isSelected)
+            fill = fill.brighter(0.15f);
+
+        g.setColour(fill);
+        g.fillRoundedRectangle(cell, 2.0f);
+
+        g.setColour(isSelected ? juce::Colours::black : textOff);
+        g.drawText(juce::String(i + 1), cell, juce::Justification::centred);
+    }
+}
+
+void AlgorithmSelector::mouseDown(const juce::MouseEvent& e)
+{
+    const int cell = cellAt(e.getPosition());
+    if (cell >= 0 && onAlgorithmSelected)
+        onAlgorithmSelected(cell);
+}
+
+void AlgorithmSelector::mouseMove(const juce::MouseEvent& e)
+{
+    const int cell = cellAt(e.getPosition());
+    if (cell != hovered)
+    {
+        hovered = cell;
+        repaint();
+    }
+}
+
+void AlgorithmSelector::mouseExit(const juce::MouseEvent&)
+{
+    if (hovered != -1)
+    {
+        hovered = -1;
+        repaint();
+    }
+}
+
 //==============================================================================
 // Ossian19FmEditor
 //==============================================================================
@@ -175,20 +257,11 @@ void Ossian19FmEditor::createControls()
     };
     addAndMakeVisible(algoNextButton.get());
 
-    // Algorithm selector buttons (2 rows of 16)
-    for (int i = 0; i < 32; ++i)
-    {
-        algoButtons[i] = std::make_unique<juce::TextButton>(juce::String(i + 1));
-        algoButtons[i]->setColour(juce::TextButton::buttonColourId, juce::Colour(0xff252525));
-        algoButtons[i]->setColour(juce::TextButton::buttonOnColourId, juce::Colour(0xffffcc00));
-        algoButtons[i]->setColour(juce::TextButton::textColourOffId, juce::Colour(0xff888888));
-        algoButtons[i]->setColour(juce::TextButton::textColourOnId, juce::Colours::black);
-        algoButtons[i]->setClickingTogglesState(false);
-        algoButtons[i]->onClick = [this, i]() {
-            algoSlider->setValue(i);
-        };
-        addAndMakeVisible(algoButtons[i].get());
-    }
+    // Algorithm selector strip (2 rows of 16, one component)
+    algoSelector.onAlgorithmSelected = [this](int algo) {
+        algoSlider->setValue(algo);
+    };
+    addAndMakeVisible(algoSelector);
 
     // Initial update
     updateAlgorithmDisplay();
@@ -223,18 +296,108 @@ void Ossian19FmEditor::createControls()
     // Master
     masterVol = std::make_unique<RotaryKnob>(*vts.getParameter("master_vol"), vts, "VOLUME", juce::Colour(MASTER_COLOR));
     addAndMakeVisible(masterVol.get());
+
+    // CPU / voice meter
+    telemetryMeter = std::make_unique<TelemetryMeter>(processor.getTelemetry());
+    addAndMakeVisible(telemetryMeter.get());
+
+    // Preset browser — banks are indexed from <AppData>/Ossian19/syx (copy
+    // the repo's syx/ folder there). Scanning only reads voice names; the
+    // full patch decodes lazily when a row is selected.
+    bankIndex.scanDirectory(
+        juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+            .getChildFile("Ossian19").getChildFile("syx"));
+
+    bankSelector = std::make_unique<juce::ComboBox>();
+    bankSelector->setTextWhenNothingSelected("No banks found");
+    bankSelector->setColour(juce::ComboBox::backgroundColourId, juce::Colour(0xff252525));
+    bankSelector->setColour(juce::ComboBox::textColourId, juce::Colours::white);
+    bankSelector->setColour(juce::ComboBox::outlineColourId, juce::Colour(0xff404040));
+    int bankItemId = 1;
+    for (const auto& bank : bankIndex.getBanks())
+        bankSelector->addItem(bank.bankName, bankItemId++);
+    bankSelector->onChange = [this]() { selectBank(bankSelector->getSelectedItemIndex()); };
+    addAndMakeVisible(bankSelector.get());
+
+    presetList = std::make_unique<juce::ListBox>("presets", this);
+    presetList->setRowHeight(18);
+    presetList->setColour(juce::ListBox::backgroundColourId, juce::Colour(0xff151515));
+    presetList->setColour(juce::ListBox::outlineColourId, juce::Colour(0xff404040));
+    addAndMakeVisible(presetList.get());
+
+    if (!bankIndex.getBanks().empty())
+    {
+        bankSelector->setSelectedItemIndex(0, juce::dontSendNotification);
+        selectBank(0);
+    }
 }
 
-void Ossian19FmEditor::updateAlgorithmDisplay()
+void Ossian19FmEditor::selectBank(int bankIdx)
 {
-    int algo = (int)algoSlider->getValue();
-    algoDisplay->setAlgorithm(algo);
+    currentBank = bankIdx;
+    presetList->deselectAllRows();
+    presetList->updateContent();
+    presetList->repaint();
+
+    // Preload every voice of the selected bank into the processor's program
+    // bank so MIDI program changes 0-31 switch patches on the audio path
+    if (bankIdx >= 0 && bankIdx < (int)bankIndex.getBanks().size())
+    {
+        const auto& bank = bankIndex.getBanks()[(size_t)bankIdx];
+        std::vector<std::vector<std::pair<juce::String, float>>> programs;
+        programs.reserve(bank.voices.size());
+        for (size_t v = 0; v < bank.voices.size(); ++v)
+        {
+            std::vector<std::pair<juce::String, float>> values;
+            SyxBankIndex::decodeVoice(bank.file, (int)v, valueTreeState, values);
+            programs.push_back(std::move(values));
+        }
+        processor.setProgramBank(programs);
+    }
+}
 
-    // Update button states
-    for (int i = 0; i < 32; ++i)
+int Ossian19FmEditor::getNumRows()
+{
+    if (currentBank < 0 || currentBank >= (int)bankIndex.getBanks().size())
+        return 0;
+    return (int)bankIndex.getBanks()[(size_t)currentBank].voices.size();
+}
+
+void Ossian19FmEditor::paintListBoxItem(int rowNumber, juce::Graphics& g,
+                                        int width, int height, bool rowIsSelected)
+{
+    if (rowIsSelected)
     {
-        algoButtons[i]->setToggleState(i == algo, juce::dontSendNotification);
+        g.setColour(juce::Colour(0xff6bcb77).withAlpha(0.3f));
+        g.fillRect(0, 0, width, height);
     }
+
+    if (rowNumber < 0 || rowNumber >= getNumRows())
+        return;
+
+    const auto& voice = bankIndex.getBanks()[(size_t)currentBank].voices[(size_t)rowNumber];
+    g.setColour(rowIsSelected ? juce::Colours::white : juce::Colour(0xffaaaaaa));
+    g.setFont(juce::FontOptions(12.0f));
+    g.drawText(juce::String(rowNumber + 1).paddedLeft('0', 2) + "  " + voice.name,
+               6, 0, width - 12, height, juce::Justification::centredLeft);
+}
+
+void Ossian19FmEditor::selectedRowsChanged(int lastRowSelected)
+{
+    if (lastRowSelected < 0 || currentBank < 0 || currentBank >= (int)bankIndex.getBanks().size())
+        return;
+
+    const auto& bank = bankIndex.getBanks()[(size_t)currentBank];
+    std::vector<std::pair<juce::String, float>> values;
+    if (SyxBankIndex::decodeVoice(bank.file, lastRowSelected, valueTreeState, values))
+        processor.loadPreset(values);
+}
+
+void Ossian19FmEditor::updateAlgorithmDisplay()
+{
+    int algo = (int)algoSlider->getValue();
+    algoDisplay->setAlgorithm(algo);
+    algoSelector.setSelected(algo);
 }
 
 void Ossian19FmEditor::paint(juce::Graphics& g)
@@ -266,6 +429,16 @@ void Ossian19FmEditor::paint(juce::Graphics& g)
     g.setFont(juce::FontOptions(14.0f).withStyle("Bold"));
     g.drawText("ALGORITHM", 540, 12, 100, 20, juce::Justification::left);
 
+    // Preset browser background (below the algorithm section)
+    g.setColour(juce::Colour(0xff1a1a1a));
+    g.fillRoundedRectangle(530.0f, 238.0f, 500.0f, 237.0f, 8.0f);
+    g.setColour(juce::Colour(0xff6bcb77).withAlpha(0.5f));
+    g.drawRoundedRectangle(530.0f, 238.0f, 500.0f, 237.0f, 8.0f, 1.5f);
+
+    g.setColour(juce::Colour(0xff6bcb77));
+    g.setFont(juce::FontOptions(14.0f).withStyle("Bold"));
+    g.drawText("PRESETS", 540, 242, 100, 20, juce::Justification::left);
+
     // Bottom section backgrounds
     float bottomY = 485.0f;
 
@@ -314,22 +487,13 @@ void Ossian19FmEditor::resized()
     // Next button
     algoNextButton->setBounds(algoSectionX + 425, algoSectionY + 30, 35, 120);
 
-    // Algorithm buttons (2 rows of 16)
+    // Algorithm selector strip (2 rows of 16); same footprint the 32
+    // individual buttons used to occupy
     const int btnW = 28;
     const int btnH = 22;
     const int btnGap = 2;
-    int btnX = algoSectionX;
-    int btnY = algoSectionY + 190;  // Below the larger display
-
-    for (int i = 0; i < 16; ++i)
-    {
-        algoButtons[i]->setBounds(btnX + i * (btnW + btnGap), btnY, btnW, btnH);
-    }
-    btnY += btnH + btnGap;
-    for (int i = 16; i < 32; ++i)
-    {
-        algoButtons[i]->setBounds(btnX + (i - 16) * (btnW + btnGap), btnY, btnW, btnH);
-    }
+    algoSelector.setBounds(algoSectionX, algoSectionY + 190,
+                           16 * (btnW + btnGap) - btnGap, 2 * (btnH + btnGap) - btnGap);
 
     // Operators - 2 rows of 3 (left side)
     int x = margin;
@@ -362,4 +526,11 @@ void Ossian19FmEditor::resized()
 
     // Master
     masterVol->setBounds(425, bottomY + 25, knobW, knobH);
+
+    // CPU / voice meter (top strip, between the title and algorithm section)
+    telemetryMeter->setBounds(320, 10, 200, 36);
+
+    // Preset browser (right side, below the algorithm section)
+    bankSelector->setBounds(640, 241, 380, 22);
+    presetList->setBounds(540, 270, 480, 198);
 }
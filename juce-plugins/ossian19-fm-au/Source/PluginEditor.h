@@ -4,6 +4,7 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "PluginProcessor.h"
 #include "AlgorithmDisplay.h"
+#include "SyxBank.h"
 
 //==============================================================================
 class RotaryKnob : public juce::Component
@@ -53,7 +54,35 @@ private:
 };
 
 //==============================================================================
-class Ossian19FmEditor : public juce::AudioProcessorEditor
+// Algorithm selector strip: one custom-painted component (2 rows of 16
+// cells) replacing the 32 heap-allocated TextButtons the editor used to
+// build per open. Hit-testing happens in mouseDown, so selection costs no
+// child components at all.
+class AlgorithmSelector : public juce::Component
+{
+public:
+    std::function<void(int)> onAlgorithmSelected;
+
+    void setSelected(int algoIndex);
+
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent& e) override;
+    void mouseMove(const juce::MouseEvent& e) override;
+    void mouseExit(const juce::MouseEvent& e) override;
+
+private:
+    juce::Rectangle<int> cellBounds(int index) const;
+    int cellAt(juce::Point<int> pos) const;
+
+    int selected = 0;
+    int hovered = -1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AlgorithmSelector)
+};
+
+//==============================================================================
+class Ossian19FmEditor : public juce::AudioProcessorEditor,
+                         private juce::ListBoxModel
 {
 public:
     explicit Ossian19FmEditor(Ossian19FmProcessor&);
@@ -85,7 +114,7 @@ private:
     std::unique_ptr<juce::TextButton> algoNextButton;
     std::unique_ptr<juce::Slider> algoSlider;  // Hidden slider for parameter attachment
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> algoAttachment;
-    std::array<std::unique_ptr<juce::TextButton>, 32> algoButtons;
+    AlgorithmSelector algoSelector;
 
     void updateAlgorithmDisplay();
 
@@ -105,6 +134,23 @@ private:
     // Master
     std::unique_ptr<RotaryKnob> masterVol;
 
+    // CPU / voice meter fed by the processor's telemetry ring
+    std::unique_ptr<TelemetryMeter> telemetryMeter;
+
+    // Preset browser backed by the memory-mapped SYX bank index
+    SyxBankIndex bankIndex;
+    std::unique_ptr<juce::ComboBox> bankSelector;
+    std::unique_ptr<juce::ListBox> presetList;
+    int currentBank = -1;
+
+    void selectBank(int bankIdx);
+
+    // juce::ListBoxModel (voice list of the selected bank)
+    int getNumRows() override;
+    void paintListBoxItem(int rowNumber, juce::Graphics& g,
+                          int width, int height, bool rowIsSelected) override;
+    void selectedRowsChanged(int lastRowSelected) override;
+
     void createControls();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Ossian19FmEditor)
@@ -1,20 +1,79 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "FmAlgorithms.h"
+
+// This TU hosts the audit-mode operator new/delete replacements (no-op
+// unless the target is built with OSSIAN19_AUDIT_ALLOCATIONS=1)
+#define OSSIAN19_AUDIT_ALLOCATIONS_IMPL 1
+#include "AllocationAudit.h"
 
 Ossian19FmProcessor::Ossian19FmProcessor()
     : AudioProcessor(BusesProperties()
-        .withOutput("Output", juce::AudioChannelSet::stereo(), true))
+        .withOutput("Output", juce::AudioChannelSet::stereo(), true)
+        // Optional per-carrier stems: one mono bus per operator, disabled by
+        // default. Hosts that activate them get individual carrier sums from
+        // the same engine pass — one instance instead of one per layer.
+        .withOutput("Op 1", juce::AudioChannelSet::mono(), false)
+        .withOutput("Op 2", juce::AudioChannelSet::mono(), false)
+        .withOutput("Op 3", juce::AudioChannelSet::mono(), false)
+        .withOutput("Op 4", juce::AudioChannelSet::mono(), false)
+        .withOutput("Op 5", juce::AudioChannelSet::mono(), false)
+        .withOutput("Op 6", juce::AudioChannelSet::mono(), false))
     , parameters(*this, nullptr, "OSSIAN19FM", createParameterLayout())
 {
     synthHandle = fm_synth_create(44100.0f);
+    midiEvents.reserve(1024);
+
+    // Register change listeners so processBlock() only pushes modified
+    // parameters over the FFI instead of all ~63 every block.
+    registerParamBit(ALGORITHM, kBitAlgorithm);
+    for (int op = 0; op < 6; ++op)
+    {
+        registerParamBit(opParam(op, "ratio"),    opBit(op, kOpRatio));
+        registerParamBit(opParam(op, "level"),    opBit(op, kOpLevel));
+        registerParamBit(opParam(op, "detune"),   opBit(op, kOpDetune));
+        registerParamBit(opParam(op, "feedback"), opBit(op, kOpFeedback));
+        registerParamBit(opParam(op, "vel_sens"), opBit(op, kOpVelSens));
+        registerParamBit(opParam(op, "attack"),   opBit(op, kOpAttack));
+        registerParamBit(opParam(op, "decay"),    opBit(op, kOpDecay));
+        registerParamBit(opParam(op, "sustain"),  opBit(op, kOpSustain));
+        registerParamBit(opParam(op, "release"),  opBit(op, kOpRelease));
+    }
+    registerParamBit(FILTER_ON, kBitFilterOn);
+    registerParamBit(FILTER_CUTOFF, kBitFilterCutoff);
+    registerParamBit(FILTER_RESO, kBitFilterReso);
+    registerParamBit(VIB_DEPTH, kBitVibDepth);
+    registerParamBit(VIB_RATE, kBitVibRate);
+    registerParamBit(MASTER_VOL, kBitMasterVol);
+    registerParamBit(POLYPHONY, kBitPolyphony);
+    registerParamBit(STEAL_MODE, kBitStealMode);
 }
 
 Ossian19FmProcessor::~Ossian19FmProcessor()
 {
+    for (const auto& entry : paramBitById)
+        parameters.removeParameterListener(entry.first, this);
+
+    if (registeredPoolClient)
+        renderCoordinator->removePoolClient();
+
     if (synthHandle)
         fm_synth_destroy(synthHandle);
 }
 
+void Ossian19FmProcessor::registerParamBit(const juce::String& paramID, int bitIndex)
+{
+    paramBitById[paramID] = bitIndex;
+    parameters.addParameterListener(paramID, this);
+}
+
+void Ossian19FmProcessor::parameterChanged(const juce::String& parameterID, float /*newValue*/)
+{
+    auto it = paramBitById.find(parameterID);
+    if (it != paramBitById.end())
+        dirtyParams.fetch_or(bit(it->second), std::memory_order_release);
+}
+
 juce::AudioProcessorValueTreeState::ParameterLayout Ossian19FmProcessor::createParameterLayout()
 {
     std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
@@ -86,73 +145,293 @@ juce::AudioProcessorValueTreeState::ParameterLayout Ossian19FmProcessor::createP
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{MASTER_VOL, 1}, "Volume", 0.0f, 1.0f, 0.7f));
 
+    // Voice allocation (automatable so the CPU budget can be ridden per track)
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID{POLYPHONY, 1}, "Polyphony", 1, 32, 8));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{STEAL_MODE, 1}, "Voice Steal",
+        juce::StringArray{"Oldest", "Quietest", "Same Note"}, 0));
+
+    // Quality: render at 2x and decimate. Costs roughly double the render
+    // time, so off by default; mostly worth it for bright patches with
+    // heavy modulation indices near Nyquist.
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{OVERSAMPLE, 1}, "2x Oversampling", false));
+
+    // CPU budget threshold as a fraction of the block deadline; 0 = off.
+    // Above it the processor sheds quiet release-phase voices (and drops
+    // oversampling) instead of dropping buffers. Appended after the
+    // original layout so count-prefixed state blobs stay compatible.
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{BUDGET, 1}, "CPU Budget",
+        juce::NormalisableRange<float>(0.0f, 0.95f, 0.0f), 0.0f));
+
     return {params.begin(), params.end()};
 }
 
-void Ossian19FmProcessor::prepareToPlay(double /*sampleRate*/, int /*samplesPerBlock*/)
+void Ossian19FmProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
+{
+    if (!synthHandle)
+        return;
+
+    preparedSampleRate = sampleRate;
+    preparedBlockSize = samplesPerBlock;
+
+    oversampleActive = *parameters.getRawParameterValue(OVERSAMPLE) > 0.5f;
+    oversampleBuffer.resize(static_cast<size_t>(2 * juce::jmax(1, samplesPerBlock)));
+    decimator.reset();
+    setLatencySamples(oversampleActive ? HalfBandDecimator::kLatencySamples : 0);
+
+    fm_synth_set_sample_rate(synthHandle,
+        static_cast<float>(oversampleActive ? sampleRate * 2.0 : sampleRate));
+
+    // Engine-side scratch sized for the worst case (2x block when
+    // oversampling kicks in) so the audio path never allocates
+    fm_synth_prewarm(synthHandle, 2 * juce::jmax(1, samplesPerBlock));
+
+    updateRenderThreading();
+}
+
+bool Ossian19FmProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    const auto mainOut = layouts.getChannelSet(false, 0);
+    if (mainOut != juce::AudioChannelSet::stereo() && mainOut != juce::AudioChannelSet::mono())
+        return false;
+
+    // Carrier stem buses are mono or off
+    for (int i = 1; i < layouts.outputBuses.size(); ++i)
+    {
+        const auto set = layouts.getChannelSet(false, i);
+        if (!set.isDisabled() && set != juce::AudioChannelSet::mono())
+            return false;
+    }
+    return true;
+}
+
+void Ossian19FmProcessor::setNonRealtime(bool isNonRealtime) noexcept
+{
+    AudioProcessor::setNonRealtime(isNonRealtime);
+    updateRenderThreading();
+}
+
+void Ossian19FmProcessor::updateRenderThreading()
+{
+    if (!synthHandle)
+        return;
+
+    fm_synth_set_offline(synthHandle, isNonRealtime());
+
+    // Realtime, worker-pool rendering only pays off once the block is large
+    // enough to amortize the fork/join. Offline bounces care about throughput
+    // alone, so they always get the pool. Instances that qualify register
+    // with the process-wide coordinator, which splits the core budget
+    // across everyone instead of letting each instance size its pool as if
+    // it were alone.
+    const bool wantsPool = isNonRealtime() || preparedBlockSize >= 512;
+    if (wantsPool != registeredPoolClient)
+    {
+        if (wantsPool)
+            renderCoordinator->addPoolClient();
+        else
+            renderCoordinator->removePoolClient();
+        registeredPoolClient = wantsPool;
+    }
+
+    // Size the engine's persistent worker pool for the largest share the
+    // coordinator could ever hand us. The pool grows but never shrinks, so
+    // spawning happens here (message thread) and the render-thread re-split
+    // poll in processBlock() only ever changes how many workers get used.
+    if (registeredPoolClient)
+        fm_synth_set_num_threads(synthHandle, renderCoordinator->maxThreadsPerClient());
+
+    applyThreadBudget();
+}
+
+void Ossian19FmProcessor::applyThreadBudget()
 {
-    // FM synth doesn't have set_sample_rate - it's set at creation
+    // Read the generation before the share so a re-split racing this call is
+    // picked up again at the next block rather than missed.
+    appliedThreadGeneration = renderCoordinator->currentGeneration();
+    const int numThreads = !registeredPoolClient ? 1
+        : isNonRealtime() ? renderCoordinator->offlineThreadsPerClient()
+                          : renderCoordinator->realtimeThreadsPerClient();
+    fm_synth_set_num_threads(synthHandle, numThreads);
 }
 
 void Ossian19FmProcessor::releaseResources()
 {
     if (synthHandle)
         fm_synth_all_notes_off(synthHandle);
+
+    // Give our slice of the process-wide thread budget back while idle;
+    // prepareToPlay() re-registers
+    if (registeredPoolClient)
+    {
+        renderCoordinator->removePoolClient();
+        registeredPoolClient = false;
+    }
 }
 
-void Ossian19FmProcessor::applyParameters()
+void Ossian19FmProcessor::loadPreset(const std::vector<std::pair<juce::String, float>>& normalizedValues)
 {
-    if (!synthHandle) return;
+    for (const auto& [paramID, value] : normalizedValues)
+        if (auto* param = parameters.getParameter(paramID))
+            param->setValueNotifyingHost(value);
 
-    // Algorithm
-    fm_synth_set_algorithm(synthHandle,
-        static_cast<int32_t>(*parameters.getRawParameterValue(ALGORITHM)));
+    // The listener callbacks above marked everything they touched dirty;
+    // supersede them with a single engine-side preset apply on the next block.
+    presetPending = true;
+}
+
+void Ossian19FmProcessor::buildProgramBlock(
+    const std::vector<std::pair<juce::String, float>>& normalizedValues,
+    FmParamBlock& block) const
+{
+    // Denormalize through each parameter's own range so the block holds the
+    // same engine values applyParameters() would produce; parameters absent
+    // from the program keep their current value.
+    auto value = [this, &normalizedValues](const juce::String& paramID) -> float
+    {
+        auto* param = parameters.getParameter(paramID);
+        for (const auto& [id, normalized] : normalizedValues)
+            if (id == paramID)
+                return param != nullptr ? param->convertFrom0to1(normalized) : normalized;
+        return *parameters.getRawParameterValue(paramID);
+    };
+
+    block.dirty_mask = ~0ull;
+    block.algorithm = static_cast<int32_t>(value(ALGORITHM));
 
-    // Per-operator parameters
     for (int op = 0; op < 6; ++op)
     {
-        fm_synth_set_op_ratio(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "ratio")));
-        fm_synth_set_op_level(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "level")));
-        fm_synth_set_op_detune(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "detune")));
-        fm_synth_set_op_feedback(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "feedback")));
-        fm_synth_set_op_velocity_sens(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "vel_sens")));
-        fm_synth_set_op_attack(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "attack")));
-        fm_synth_set_op_decay(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "decay")));
-        fm_synth_set_op_sustain(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "sustain")));
-        fm_synth_set_op_release(synthHandle, op,
-            *parameters.getRawParameterValue(opParam(op, "release")));
+        block.ops[op].ratio         = value(opParam(op, "ratio"));
+        block.ops[op].level         = value(opParam(op, "level"));
+        block.ops[op].detune        = value(opParam(op, "detune"));
+        block.ops[op].feedback      = value(opParam(op, "feedback"));
+        block.ops[op].velocity_sens = value(opParam(op, "vel_sens"));
+        block.ops[op].attack        = value(opParam(op, "attack"));
+        block.ops[op].decay         = value(opParam(op, "decay"));
+        block.ops[op].sustain       = value(opParam(op, "sustain"));
+        block.ops[op].release       = value(opParam(op, "release"));
     }
 
-    // Filter
-    fm_synth_set_filter_enabled(synthHandle,
-        *parameters.getRawParameterValue(FILTER_ON) > 0.5f);
-    fm_synth_set_filter_cutoff(synthHandle,
-        *parameters.getRawParameterValue(FILTER_CUTOFF));
-    fm_synth_set_filter_resonance(synthHandle,
-        *parameters.getRawParameterValue(FILTER_RESO));
+    block.filter_enabled   = value(FILTER_ON) > 0.5f;
+    block.filter_cutoff    = value(FILTER_CUTOFF);
+    block.filter_resonance = value(FILTER_RESO);
+    block.vibrato_depth    = value(VIB_DEPTH);
+    block.vibrato_rate     = value(VIB_RATE);
+    block.master_volume    = value(MASTER_VOL);
+}
 
-    // Vibrato
-    fm_synth_set_vibrato_depth(synthHandle,
-        *parameters.getRawParameterValue(VIB_DEPTH));
-    fm_synth_set_vibrato_rate(synthHandle,
-        *parameters.getRawParameterValue(VIB_RATE));
+void Ossian19FmProcessor::setProgramBank(
+    const std::vector<std::vector<std::pair<juce::String, float>>>& programs)
+{
+    // Decode outside the lock; the audio thread only ever trylocks, so the
+    // lock is held just long enough to swap the slots in.
+    std::vector<ProgramSlot> decoded(juce::jmin((size_t)kNumPrograms, programs.size()));
+    for (size_t i = 0; i < decoded.size(); ++i)
+    {
+        buildProgramBlock(programs[i], decoded[i].block);
+        decoded[i].normalized = programs[i];
+        decoded[i].valid = true;
+    }
 
-    // Master
-    fm_synth_set_master_volume(synthHandle,
-        *parameters.getRawParameterValue(MASTER_VOL));
+    const juce::SpinLock::ScopedLockType lock(programLock);
+    for (size_t i = 0; i < decoded.size(); ++i)
+        programBank[i] = std::move(decoded[i]);
+}
+
+void Ossian19FmProcessor::applyProgramChange(int programIndex)
+{
+    if (programIndex < 0 || programIndex >= kNumPrograms)
+        return;
+
+    // Never block the audio thread: if the bank is being rebuilt right now,
+    // drop the program change rather than wait.
+    const juce::SpinLock::ScopedTryLockType lock(programLock);
+    if (!lock.isLocked() || !programBank[(size_t)programIndex].valid)
+        return;
+
+    // kill_voices=false: live patch switching should let old notes ring out
+    // under the new patch rather than chopping their tails.
+    fm_synth_apply_preset(synthHandle, &programBank[(size_t)programIndex].block, false);
+
+    // Sync the APVTS on the message thread so host/UI state catches up; the
+    // listener callbacks will re-push the same values, which the engine
+    // treats as a no-op.
+    lastProgramApplied.store(programIndex, std::memory_order_release);
+    triggerAsyncUpdate();
+}
+
+void Ossian19FmProcessor::handleAsyncUpdate()
+{
+    const int programIndex = lastProgramApplied.load(std::memory_order_acquire);
+    if (programIndex < 0 || programIndex >= kNumPrograms)
+        return;
+
+    std::vector<std::pair<juce::String, float>> values;
+    {
+        const juce::SpinLock::ScopedLockType lock(programLock);
+        if (!programBank[(size_t)programIndex].valid)
+            return;
+        values = programBank[(size_t)programIndex].normalized;
+    }
+    for (const auto& [paramID, value] : values)
+        if (auto* param = parameters.getParameter(paramID))
+            param->setValueNotifyingHost(value);
+}
+
+void Ossian19FmProcessor::applyParameters(uint64_t dirtyBits, bool asPreset)
+{
+    if (!synthHandle) return;
+
+    // Fill one cache-friendly block and cross the FFI boundary once; the
+    // engine applies every flagged field before rendering the next sample.
+    // The ParamBit layout matches the FmParamBlock dirty_mask contract.
+    FmParamBlock block;
+    block.dirty_mask = dirtyBits;
+
+    block.algorithm = static_cast<int32_t>(*parameters.getRawParameterValue(ALGORITHM));
+
+    for (int op = 0; op < 6; ++op)
+    {
+        block.ops[op].ratio         = *parameters.getRawParameterValue(opParam(op, "ratio"));
+        block.ops[op].level         = *parameters.getRawParameterValue(opParam(op, "level"));
+        block.ops[op].detune        = *parameters.getRawParameterValue(opParam(op, "detune"));
+        block.ops[op].feedback      = *parameters.getRawParameterValue(opParam(op, "feedback"));
+        block.ops[op].velocity_sens = *parameters.getRawParameterValue(opParam(op, "vel_sens"));
+        block.ops[op].attack        = *parameters.getRawParameterValue(opParam(op, "attack"));
+        block.ops[op].decay         = *parameters.getRawParameterValue(opParam(op, "decay"));
+        block.ops[op].sustain       = *parameters.getRawParameterValue(opParam(op, "sustain"));
+        block.ops[op].release       = *parameters.getRawParameterValue(opParam(op, "release"));
+    }
+
+    block.filter_enabled   = *parameters.getRawParameterValue(FILTER_ON) > 0.5f;
+    block.filter_cutoff    = *parameters.getRawParameterValue(FILTER_CUTOFF);
+    block.filter_resonance = *parameters.getRawParameterValue(FILTER_RESO);
+    block.vibrato_depth    = *parameters.getRawParameterValue(VIB_DEPTH);
+    block.vibrato_rate     = *parameters.getRawParameterValue(VIB_RATE);
+    block.master_volume    = *parameters.getRawParameterValue(MASTER_VOL);
+
+    if (asPreset)
+        fm_synth_apply_preset(synthHandle, &block, true);
+    else
+        fm_synth_apply_params(synthHandle, &block);
+
+    // Voice allocation is not part of the block; it has dedicated setters
+    if (dirtyBits & bit(kBitPolyphony))
+        fm_synth_set_max_polyphony(synthHandle,
+            static_cast<int32_t>(*parameters.getRawParameterValue(POLYPHONY)));
+    if (dirtyBits & bit(kBitStealMode))
+        fm_synth_set_steal_policy(synthHandle,
+            static_cast<int32_t>(*parameters.getRawParameterValue(STEAL_MODE)));
 }
 
 void Ossian19FmProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    [[maybe_unused]] allocation_audit::ScopedAudit allocationAudit;
+    const auto renderStart = juce::Time::getHighResolutionTicks();
 
     if (!synthHandle)
     {
@@ -160,36 +439,248 @@ void Ossian19FmProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
         return;
     }
 
-    // Apply parameter changes
-    applyParameters();
+    // Apply parameter changes (only what changed since the last block).
+    // A pending preset supersedes individual dirty bits: the whole patch is
+    // pushed in one engine call, with sounding voices killed first.
+    const bool presetNow = presetPending.exchange(false);
+    uint64_t dirty = dirtyParams.exchange(0, std::memory_order_acq_rel);
+    if (fullPushPending.exchange(false) || presetNow)
+        dirty = ~0ull;
+    if (dirty != 0)
+        applyParameters(dirty, presetNow);
+
+    // Other instances registering or leaving re-split the process-wide
+    // thread budget; pick up our new share. Applied here so the split only
+    // ever changes on the thread that renders (same pattern as the
+    // oversampling poll below); the worker pool itself was sized for the
+    // maximum share at prepare time, so this never spawns.
+    if (registeredPoolClient
+        && renderCoordinator->currentGeneration() != appliedThreadGeneration)
+        applyThreadBudget();
+
+    // Carrier stem buses force the 1x multi-out render path, so they win
+    // over oversampling: the engine has to run at the host rate.
+    bool anyStem = false;
+    for (int op = 0; op < 6 && op + 1 < getBusCount(false); ++op)
+        if (auto* stemBus = getBus(false, op + 1); stemBus != nullptr && stemBus->isEnabled())
+            anyStem = true;
+
+    // Oversampling toggle: polled here because flipping it retunes the
+    // engine sample rate, which has to happen on the audio thread between
+    // blocks. The decimator history is stale across a rate change, so reset.
+    // The CPU budgeter vetoes oversampling while under deadline pressure —
+    // the 2x render is the single largest quality/cost lever we have.
+    const bool oversampleRequested =
+        *parameters.getRawParameterValue(OVERSAMPLE) > 0.5f && !anyStem && !budgetPressure;
+    if (oversampleRequested != oversampleActive)
+    {
+        oversampleActive = oversampleRequested;
+        fm_synth_set_sample_rate(synthHandle, static_cast<float>(
+            oversampleActive ? preparedSampleRate * 2.0 : preparedSampleRate));
+        decimator.reset();
+        setLatencySamples(oversampleActive ? HalfBandDecimator::kLatencySamples : 0);
+    }
+
+    // Convert MIDI to sample-accurate engine events. Program changes are
+    // kept out of the event stream: they are applied host-side between
+    // render segments against the preloaded program bank.
+    struct PendingProgramChange { int offset; int program; };
+    PendingProgramChange programChanges[kMaxProgramChangesPerBlock];
+    int numProgramChanges = 0;
 
-    // Process MIDI
+    midiEvents.clear();
     for (const auto metadata : midiMessages)
     {
         auto message = metadata.getMessage();
 
+        MidiEvent event {};
+        event.sample_offset = static_cast<uint32_t>(juce::jmax(0, metadata.samplePosition));
+        event.channel = static_cast<uint8_t>(juce::jmax(0, message.getChannel() - 1));
+
         if (message.isNoteOn())
         {
-            fm_synth_note_on(synthHandle,
-                static_cast<uint8_t>(message.getNoteNumber()),
-                message.getFloatVelocity());
+            event.kind = MIDI_EVENT_NOTE_ON;
+            event.data = static_cast<uint8_t>(message.getNoteNumber());
+            event.value = message.getFloatVelocity();
         }
         else if (message.isNoteOff())
         {
-            fm_synth_note_off(synthHandle,
-                static_cast<uint8_t>(message.getNoteNumber()));
+            event.kind = MIDI_EVENT_NOTE_OFF;
+            event.data = static_cast<uint8_t>(message.getNoteNumber());
+        }
+        else if (message.isPitchWheel())
+        {
+            event.kind = MIDI_EVENT_PITCH_BEND;
+            event.value = (message.getPitchWheelValue() - 8192) / 8192.0f * 12.0f;
+        }
+        else if (message.isProgramChange())
+        {
+            if (numProgramChanges < kMaxProgramChangesPerBlock)
+                programChanges[numProgramChanges++] =
+                    { juce::jmax(0, metadata.samplePosition), message.getProgramChangeNumber() };
+            continue;
         }
         else if (message.isAllNotesOff() || message.isAllSoundOff())
         {
-            fm_synth_all_notes_off(synthHandle);
+            event.kind = MIDI_EVENT_ALL_NOTES_OFF;
+        }
+        else
+        {
+            continue;
+        }
+
+        midiEvents.push_back(event);
+    }
+
+    // Process audio, applying each event at its exact sample position.
+    // Mono bus layouts take the dedicated mono path instead of rendering
+    // the same signal into one buffer twice.
+    auto mainBus = getBusBuffer(buffer, false, 0);
+    auto* leftChannel = mainBus.getWritePointer(0);
+    const int numFrames = buffer.getNumSamples();
+
+    // Per-carrier stem buses: collect enabled aux outputs. Carrier
+    // membership comes from the FM_ALGORITHMS table; an enabled bus whose
+    // operator only modulates in the current algorithm stays silent.
+    const int algo = juce::jlimit(0, 31,
+        static_cast<int>(*parameters.getRawParameterValue(ALGORITHM)));
+    const auto& carriers = FM_ALGORITHMS[static_cast<size_t>(algo)].carriers;
+    float* opOuts[6] = {};
+    for (int op = 0; op < 6 && op + 1 < getBusCount(false); ++op)
+    {
+        auto* bus = getBus(false, op + 1);
+        if (bus == nullptr || !bus->isEnabled())
+            continue;
+
+        auto stem = getBusBuffer(buffer, false, op + 1);
+        stem.clear();
+        for (auto carrier : carriers)
+            if (static_cast<int>(carrier) == op)
+                opOuts[op] = stem.getWritePointer(0);
+    }
+
+    if (oversampleActive && oversampleBuffer.size() < static_cast<size_t>(2 * numFrames))
+        oversampleBuffer.resize(static_cast<size_t>(2 * numFrames));
+
+    // One render call per segment on the active path; without program
+    // changes there is exactly one segment, i.e. the familiar single call.
+    auto renderSegment = [&](int start, int len, MidiEvent* events, size_t numEvents)
+    {
+        if (len <= 0)
+            return;
+        if (anyStem)
+        {
+            // Stems force the single-pass multi-out render. It runs serially
+            // and at 1x; oversampling applies to the plain stereo path only.
+            float* segOuts[6];
+            for (int op = 0; op < 6; ++op)
+                segOuts[op] = opOuts[op] != nullptr ? opOuts[op] + start : nullptr;
+            fm_synth_process_events_multi(synthHandle, events, numEvents,
+                                          leftChannel + start, segOuts,
+                                          static_cast<size_t>(len));
+        }
+        else if (oversampleActive)
+        {
+            // Render mono at 2x into the scratch buffer; the whole block is
+            // decimated in one pass afterwards
+            fm_synth_process_events_mono(synthHandle, events, numEvents,
+                                         oversampleBuffer.data() + 2 * start,
+                                         static_cast<size_t>(2 * len));
+        }
+        else if (mainBus.getNumChannels() == 1)
+        {
+            fm_synth_process_events_mono(synthHandle, events, numEvents,
+                                         leftChannel + start, static_cast<size_t>(len));
         }
+        else
+        {
+            fm_synth_process_events(synthHandle, events, numEvents,
+                                    leftChannel + start,
+                                    mainBus.getWritePointer(1) + start,
+                                    static_cast<size_t>(len));
+        }
+    };
+
+    // Walk the block, cutting a segment before each program change so the
+    // new patch takes effect at its exact sample position. Event offsets
+    // are rebased to the segment (and moved to the 2x timeline when
+    // oversampling) as they are consumed.
+    int cursor = 0;
+    size_t eventCursor = 0;
+    auto renderUpTo = [&](int end)
+    {
+        end = juce::jlimit(cursor, numFrames, end);
+        const size_t firstEvent = eventCursor;
+        while (eventCursor < midiEvents.size()
+               && static_cast<int>(midiEvents[eventCursor].sample_offset) < end)
+        {
+            auto& event = midiEvents[eventCursor];
+            event.sample_offset = static_cast<uint32_t>(
+                static_cast<int>(event.sample_offset) - cursor) * (oversampleActive ? 2u : 1u);
+            ++eventCursor;
+        }
+        renderSegment(cursor, end - cursor,
+                      midiEvents.data() + firstEvent, eventCursor - firstEvent);
+        cursor = end;
+    };
+
+    for (int i = 0; i < numProgramChanges; ++i)
+    {
+        renderUpTo(programChanges[i].offset);
+        applyProgramChange(programChanges[i].program);
     }
+    renderUpTo(numFrames);
 
-    // Process audio
-    auto* leftChannel = buffer.getWritePointer(0);
-    auto* rightChannel = buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : leftChannel;
+    if (oversampleActive)
+        decimator.process(oversampleBuffer.data(), leftChannel, numFrames);
 
-    fm_synth_process(synthHandle, leftChannel, rightChannel, static_cast<size_t>(buffer.getNumSamples()));
+    if (anyStem || oversampleActive)
+        for (int ch = 1; ch < mainBus.getNumChannels(); ++ch)
+            mainBus.copyFrom(ch, 0, leftChannel, numFrames);
+
+    // Telemetry for the editor's CPU/voice meter: wait-free push, no locks
+    // or allocation on the audio path. Meaningless (and pure overhead)
+    // during an offline bounce, so skipped there.
+    if (!isNonRealtime())
+    {
+        const int numSamples = buffer.getNumSamples();
+        TelemetryFrame frame;
+        frame.renderTimeMs = static_cast<float>(juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - renderStart)) * 1000.0f;
+        frame.blockDurationMs = getSampleRate() > 0.0
+            ? static_cast<float>(numSamples / getSampleRate() * 1000.0) : 0.0f;
+        frame.peakLeft = buffer.getMagnitude(0, 0, numSamples);
+        frame.peakRight = buffer.getNumChannels() > 1
+            ? buffer.getMagnitude(1, 0, numSamples) : frame.peakLeft;
+        frame.activeVoices = fm_synth_active_voices(synthHandle);
+        telemetry.push(frame);
+
+        // CPU budgeter: when the smoothed load crosses the threshold, shed
+        // the quietest release-phase voices (the engine collapses their
+        // remaining release to ~20 ms) and keep oversampling vetoed until
+        // pressure clears. One-pole smoothing keeps a single slow block
+        // from triggering it; the lower exit threshold keeps it from
+        // flapping around the limit.
+        const float budgetThreshold = *parameters.getRawParameterValue(BUDGET);
+        if (budgetThreshold > 0.0f && frame.blockDurationMs > 0.0f)
+        {
+            const float load = frame.renderTimeMs / frame.blockDurationMs;
+            smoothedLoad = smoothedLoad * 0.8f + load * 0.2f;
+
+            if (smoothedLoad > budgetThreshold)
+                budgetPressure = true;
+            else if (smoothedLoad < budgetThreshold * 0.7f)
+                budgetPressure = false;
+
+            if (budgetPressure)
+                fm_synth_shed_voices(synthHandle, 2);
+        }
+        else
+        {
+            smoothedLoad = 0.0f;
+            budgetPressure = false;
+        }
+    }
 }
 
 juce::AudioProcessorEditor* Ossian19FmProcessor::createEditor()
@@ -199,16 +690,54 @@ juce::AudioProcessorEditor* Ossian19FmProcessor::createEditor()
 
 void Ossian19FmProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = parameters.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    // Versioned little-endian binary blob: fixed header followed by the
+    // normalized parameter values in layout order. Orders of magnitude
+    // cheaper than the old XML round-trip when a session holds dozens of
+    // instances or the host autosaves.
+    juce::MemoryOutputStream out(destData, false);
+    const auto& params = getParameters();
+
+    out.writeInt(kStateMagic);
+    out.writeInt(kStateVersion);
+    out.writeInt(params.size());
+    for (auto* param : params)
+        out.writeFloat(param->getValue());
 }
 
 void Ossian19FmProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    juce::MemoryInputStream in(data, static_cast<size_t>(sizeInBytes), false);
+
+    if (sizeInBytes >= 12 && in.readInt() == kStateMagic)
+    {
+        const int version = in.readInt();
+        if (version > kStateVersion)
+            return; // written by a newer build; don't guess
+
+        const int count = in.readInt();
+        const auto& params = getParameters();
+        for (int i = 0; i < count && !in.isExhausted(); ++i)
+        {
+            const float value = in.readFloat();
+            // Diff against the live value: untouched parameters fire no
+            // listeners and set no dirty bits, so an unchanged instance on
+            // session load — or a host undo of a single knob — costs only
+            // what actually moved instead of a full ~63-value re-push.
+            // Values round-trip bit-exactly through the blob (getValue()
+            // was what got written), so an exact compare is enough.
+            if (i < params.size() && params[i]->getValue() != value)
+                params[i]->setValueNotifyingHost(value);
+        }
+        return;
+    }
+
+    // Fallback reader for sessions saved by the XML-based versions
     std::unique_ptr<juce::XmlElement> xml(getXmlFromBinary(data, sizeInBytes));
     if (xml && xml->hasTagName(parameters.state.getType()))
+    {
         parameters.replaceState(juce::ValueTree::fromXml(*xml));
+        fullPushPending = true;
+    }
 }
 
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
@@ -1,9 +1,19 @@
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <atomic>
+#include <map>
+#include <vector>
 #include "ossian19.h"
+#include "Telemetry.h"
+#include "HalfBandDecimator.h"
+#include "SharedEngineTables.h"
+#include "RenderCoordinator.h"
 
-class Ossian19FmProcessor : public juce::AudioProcessor
+class Ossian19FmProcessor : public juce::AudioProcessor,
+                            private juce::AudioProcessorValueTreeState::Listener,
+                            private juce::AsyncUpdater
 {
 public:
     Ossian19FmProcessor();
@@ -12,6 +22,8 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void setNonRealtime(bool isNonRealtime) noexcept override;
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -31,8 +43,28 @@ public:
     void setStateInformation(const void* data, int sizeInBytes) override;
 
     juce::AudioProcessorValueTreeState& getValueTreeState() { return parameters; }
+    TelemetryRing& getTelemetry() { return telemetry; }
+
+    // Atomically loads a full patch: writes the normalized values to the
+    // APVTS (host and UI stay in sync) and schedules one engine-side preset
+    // apply with voice kill for the next block, instead of letting ~70
+    // listener callbacks trickle through the dirty mask while voices sound.
+    void loadPreset(const std::vector<std::pair<juce::String, float>>& normalizedValues);
+
+    // Preloads MIDI programs for audio-path program changes: each entry is
+    // decoded into a ready-to-apply FmParamBlock here (message thread), so
+    // processBlock() can switch patches at the event's sample position with
+    // zero allocation and no main-thread round trip. The editor calls this
+    // when a .syx bank is selected; slots beyond the vector keep their
+    // previous contents.
+    void setProgramBank(
+        const std::vector<std::vector<std::pair<juce::String, float>>>& programs);
 
 private:
+    // Declared before synthHandle so the shared tables exist by the time
+    // fm_synth_create runs; the first instance builds them, the rest share
+    juce::SharedResourcePointer<SharedEngineTables> sharedTables;
+
     FmSynthHandle synthHandle = nullptr;
     juce::AudioProcessorValueTreeState parameters;
 
@@ -44,14 +76,110 @@ private:
     static constexpr const char* VIB_DEPTH = "vib_depth";
     static constexpr const char* VIB_RATE = "vib_rate";
     static constexpr const char* MASTER_VOL = "master_vol";
+    static constexpr const char* POLYPHONY = "polyphony";
+    static constexpr const char* STEAL_MODE = "steal_mode";
+    static constexpr const char* OVERSAMPLE = "oversample";
+    static constexpr const char* BUDGET = "cpu_budget";
+
+    // Binary state blob: "O19F" magic, version, then the normalized
+    // parameter values packed in layout order (little-endian throughout)
+    static constexpr int kStateMagic = 0x4F313946;  // "O19F"
+    static constexpr int kStateVersion = 1;
 
     // Per-operator parameter ID helpers
     static juce::String opParam(int op, const char* param) {
         return juce::String("op") + juce::String(op + 1) + "_" + param;
     }
 
+    // Bit positions in the dirty-parameter mask (one bit per engine parameter).
+    // APVTS listeners set bits from the host/UI threads; processBlock() drains
+    // the mask at block start so only changed values cross the FFI boundary.
+    enum ParamBit : int
+    {
+        kBitAlgorithm    = 0,
+        kBitOpBase       = 1,   // 9 bits per operator, 6 operators (bits 1-54)
+        kBitFilterOn     = 55,
+        kBitFilterCutoff = 56,
+        kBitFilterReso   = 57,
+        kBitVibDepth     = 58,
+        kBitVibRate      = 59,
+        kBitMasterVol    = 60,
+        kBitPolyphony    = 61,
+        kBitStealMode    = 62,
+    };
+    enum OpParamBit : int
+    {
+        kOpRatio = 0, kOpLevel, kOpDetune, kOpFeedback, kOpVelSens,
+        kOpAttack, kOpDecay, kOpSustain, kOpRelease,
+        kNumOpParams
+    };
+    static constexpr int opBit(int op, int param) { return kBitOpBase + op * kNumOpParams + param; }
+    static constexpr uint64_t bit(int b) { return 1ull << b; }
+
+    std::atomic<uint64_t> dirtyParams { 0 };
+    std::atomic<bool> fullPushPending { true };
+    std::atomic<bool> presetPending { false };
+    std::map<juce::String, int> paramBitById;
+
+    // Scratch buffer for sample-accurate event scheduling (reserved up
+    // front so processBlock() normally does not allocate)
+    std::vector<MidiEvent> midiEvents;
+
+    // Per-block render stats for the editor's CPU/voice meter
+    TelemetryRing telemetry;
+
+    // Block size from the last prepareToPlay(); threading decisions depend on it
+    int preparedBlockSize = 0;
+
+    // Process-wide arbiter splitting the core budget across all plugin
+    // instances that use the engine worker pool. The generation stamp lets
+    // processBlock() notice a re-split with one atomic load.
+    juce::SharedResourcePointer<RenderCoordinator> renderCoordinator;
+    bool registeredPoolClient = false;
+    juce::uint32 appliedThreadGeneration = 0;
+
+    // 2x oversampling: the engine renders at twice the host rate into
+    // oversampleBuffer (sized in prepareToPlay so the audio path does not
+    // allocate), then the half-band decimator folds it back down. The
+    // quality parameter is polled per block rather than going through the
+    // dirty mask because toggling it changes the engine sample rate.
+    std::vector<float> oversampleBuffer;
+    HalfBandDecimator decimator;
+    bool oversampleActive = false;
+    double preparedSampleRate = 0.0;
+
+    // CPU budgeter state: one-pole smoothed load (render time / deadline)
+    // and whether we are currently degrading quality. Audio thread only.
+    float smoothedLoad = 0.0f;
+    bool budgetPressure = false;
+
+    // MIDI program bank: decoded parameter blocks ready for the audio
+    // thread. The block is applied via fm_synth_apply_preset; the normalized
+    // values are kept so the APVTS can be synced afterwards on the message
+    // thread (AsyncUpdater), keeping host/UI state coherent.
+    struct ProgramSlot
+    {
+        bool valid = false;
+        FmParamBlock block {};
+        std::vector<std::pair<juce::String, float>> normalized;
+    };
+    static constexpr int kNumPrograms = 128;
+    static constexpr int kMaxProgramChangesPerBlock = 8;
+    std::array<ProgramSlot, kNumPrograms> programBank;
+    juce::SpinLock programLock;
+    std::atomic<int> lastProgramApplied { -1 };
+
+    void registerParamBit(const juce::String& paramID, int bitIndex);
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void updateRenderThreading();
+    void applyThreadBudget();
+    void handleAsyncUpdate() override;
+
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
-    void applyParameters();
+    void applyParameters(uint64_t dirtyBits, bool asPreset = false);
+    void buildProgramBlock(const std::vector<std::pair<juce::String, float>>& normalizedValues,
+                           FmParamBlock& block) const;
+    void applyProgramChange(int programIndex);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Ossian19FmProcessor)
 };
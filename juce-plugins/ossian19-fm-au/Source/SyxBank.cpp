@@ -0,0 +1,135 @@
+#include "SyxBank.h"
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+constexpr int kHeaderSize = 6;      // F0 43 00 09 20 00
+constexpr int kVoiceSize = 128;
+constexpr int kVoiceCount = 32;
+constexpr int kBankFileSize = 4104; // header + 32*128 voice bytes + checksum + F7
+constexpr int kNameOffset = 118;    // within a voice record
+constexpr int kNameLength = 10;
+constexpr int kGlobalOffset = 102;  // global voice parameters within a record
+
+bool hasBankHeader(const uint8_t* data)
+{
+    static const uint8_t header[kHeaderSize] = { 0xF0, 0x43, 0x00, 0x09, 0x20, 0x00 };
+    return std::memcmp(data, header, kHeaderSize) == 0;
+}
+
+juce::String readVoiceName(const uint8_t* record)
+{
+    char name[kNameLength];
+    for (int i = 0; i < kNameLength; ++i)
+    {
+        const char c = static_cast<char>(record[kNameOffset + i] & 0x7F);
+        name[i] = (c >= 32 && c < 127) ? c : ' ';
+    }
+    return juce::String(name, kNameLength).trim();
+}
+
+// DX7 EG rates run 0 (slowest) to 99 (instant); the squared taper matches
+// the web importer's mapping in dx7-6op-converter.ts
+float dx7RateToSeconds(int rate)
+{
+    if (rate >= 99) return 0.001f;
+    if (rate <= 0) return 10.0f;
+    const float normalized = static_cast<float>(99 - rate) / 99.0f;
+    return 0.001f + (10.0f - 0.001f) * normalized * normalized;
+}
+
+float dx7Ratio(const uint8_t* opData)
+{
+    if ((opData[15] & 0x01) == 1)
+        return 1.0f;  // fixed-frequency operators fall back to 1:1
+
+    const int coarse = (opData[15] >> 1) & 0x1F;
+    const float base = coarse == 0 ? 0.5f : static_cast<float>(coarse);
+    return base + static_cast<float>(opData[16]) / 100.0f;
+}
+} // namespace
+
+void SyxBankIndex::scanDirectory(const juce::File& directory)
+{
+    banks.clear();
+
+    for (const auto& file : directory.findChildFiles(juce::File::findFiles, false, "*.syx"))
+    {
+        if (file.getSize() != kBankFileSize)
+            continue;
+
+        // Map read-only and touch only the header plus the name bytes of
+        // each voice record; the rest of the bank is never paged in
+        juce::MemoryMappedFile map(file, juce::MemoryMappedFile::readOnly);
+        const auto* data = static_cast<const uint8_t*>(map.getData());
+        if (data == nullptr || map.getSize() < static_cast<size_t>(kBankFileSize)
+            || !hasBankHeader(data))
+            continue;
+
+        SyxBankInfo bank;
+        bank.file = file;
+        bank.bankName = file.getFileNameWithoutExtension();
+        bank.voices.reserve(kVoiceCount);
+        for (int i = 0; i < kVoiceCount; ++i)
+            bank.voices.push_back({ readVoiceName(data + kHeaderSize + i * kVoiceSize), i });
+
+        banks.push_back(std::move(bank));
+    }
+}
+
+bool SyxBankIndex::decodeVoice(const juce::File& file, int voiceIndex,
+                               juce::AudioProcessorValueTreeState& parameters,
+                               std::vector<std::pair<juce::String, float>>& valuesOut)
+{
+    if (voiceIndex < 0 || voiceIndex >= kVoiceCount || file.getSize() != kBankFileSize)
+        return false;
+
+    juce::MemoryMappedFile map(file, juce::MemoryMappedFile::readOnly);
+    const auto* data = static_cast<const uint8_t*>(map.getData());
+    if (data == nullptr || !hasBankHeader(data))
+        return false;
+
+    const uint8_t* record = data + kHeaderSize + voiceIndex * kVoiceSize;
+    valuesOut.clear();
+
+    auto push = [&](const juce::String& paramID, float plainValue)
+    {
+        if (auto* param = parameters.getParameter(paramID))
+        {
+            const auto& range = param->getNormalisableRange();
+            valuesOut.emplace_back(paramID, range.convertTo0to1(
+                juce::jlimit(range.start, range.end, plainValue)));
+        }
+    };
+
+    push("algorithm", static_cast<float>(record[kGlobalOffset + 8] & 0x1F));
+
+    const int feedback = record[kGlobalOffset + 9] & 0x07;
+
+    for (int op = 0; op < 6; ++op)
+    {
+        const uint8_t* opData = record + op * 17;
+        const juce::String prefix = "op" + juce::String(op + 1) + "_";
+
+        push(prefix + "ratio", dx7Ratio(opData));
+        push(prefix + "level", std::pow(static_cast<float>(opData[14]) / 99.0f, 0.9f));
+        push(prefix + "detune", static_cast<float>(((opData[12] >> 3) & 0x0F) - 7) * 10.0f);
+        // The DX7 routes feedback to the loop operator; our engine models it
+        // on OP6, matching the web importer
+        push(prefix + "feedback", op == 5 ? static_cast<float>(feedback) / 7.0f : 0.0f);
+        push(prefix + "vel_sens", static_cast<float>((opData[13] >> 2) & 0x07) / 7.0f);
+        push(prefix + "attack", dx7RateToSeconds(opData[0]));
+        push(prefix + "decay", dx7RateToSeconds(opData[1]));
+        push(prefix + "sustain", static_cast<float>(opData[6]) / 99.0f);
+        push(prefix + "release", dx7RateToSeconds(opData[3]));
+    }
+
+    // DX7 voices have no filter; leave it bypassed and fully open
+    push("filter_on", 0.0f);
+    push("filter_cutoff", 20000.0f);
+    push("filter_reso", 0.0f);
+    push("master_vol", 0.7f);
+
+    return !valuesOut.empty();
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <utility>
+#include <vector>
+
+//==============================================================================
+// DX7 32-voice bank (.syx) index
+//
+// Scanning memory-maps each bank and touches only the 10 name bytes of every
+// 128-byte voice record, so indexing a large library reads kilobytes instead
+// of whole files. A full patch is decoded lazily when a voice is selected.
+// The packed format is documented in web/src/audio/dx7-syx-parser.ts.
+//==============================================================================
+
+// One voice entry discovered during a scan: just enough to list it
+struct SyxVoiceInfo
+{
+    juce::String name;
+    int voiceIndex;
+};
+
+struct SyxBankInfo
+{
+    juce::File file;
+    juce::String bankName;
+    std::vector<SyxVoiceInfo> voices;  // 32 entries for a valid bank
+};
+
+class SyxBankIndex
+{
+public:
+    // Indexes every valid 4104-byte DX7 bank in the directory (non-recursive)
+    void scanDirectory(const juce::File& directory);
+
+    const std::vector<SyxBankInfo>& getBanks() const { return banks; }
+
+    // Decodes one voice record into (paramID, normalized value) pairs ready
+    // for Ossian19FmProcessor::loadPreset(). Returns false if the file cannot
+    // be mapped or the voice index is out of range.
+    static bool decodeVoice(const juce::File& file, int voiceIndex,
+                            juce::AudioProcessorValueTreeState& parameters,
+                            std::vector<std::pair<juce::String, float>>& valuesOut);
+
+private:
+    std::vector<SyxBankInfo> banks;
+};
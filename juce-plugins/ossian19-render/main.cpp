@@ -0,0 +1,628 @@
+// Offline MIDI-to-WAV bounce for the OSSIAN-19 engines.
+//
+// Links libossian19_ffi.a directly (no JUCE, no audio device) so preset
+// auditions and regression audio can be batch-rendered on headless Linux
+// boxes. Reads a Standard MIDI File, optionally applies a raw parameter
+// block preset, and streams fm_synth_process_events / sub_synth_process_events
+// output straight to a 32-bit float WAV in large chunks — faster than
+// realtime, and parallelizable across files with one process per core.
+//
+//   ossian19-render --engine fm|sub --midi in.mid --out out.wav
+//                   [--preset block.bin] [--rate 48000] [--block 4096]
+//                   [--tail 30] [--threads N]
+//
+// The preset file is the raw FmParamBlock / SubParamBlock bytes (the same
+// struct the plugins pass over the FFI); its dirty mask is ignored because
+// the block is applied as a full preset. After the last MIDI event the
+// render keeps going until the engine reports zero active voices, capped
+// at --tail seconds, so release tails land on disk instead of being cut.
+
+#include "ossian19.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//==============================================================================
+// Standard MIDI File reader: formats 0 and 1, PPQ division, tempo map.
+// Only the events the engines understand are kept (note on/off, pitch bend);
+// everything else is length-skipped.
+
+// A MidiEvent stamped with its absolute sample position in the render
+// (MidiEvent::sample_offset itself is only 32-bit and block-relative)
+struct TimedEvent
+{
+    uint64_t samplePos = 0;
+    MidiEvent event {};
+};
+
+struct TickEvent
+{
+    uint64_t tick = 0;
+    int order = 0;       // file order, stable sort key for simultaneous events
+    bool isTempo = false;
+    uint32_t tempoUsPerQuarter = 0;
+    MidiEvent event {};
+};
+
+class ByteReader
+{
+public:
+    ByteReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    bool done() const { return pos_ >= size_; }
+    size_t remaining() const { return size_ - pos_; }
+
+    bool u8(uint8_t& out)
+    {
+        if (pos_ >= size_)
+            return false;
+        out = data_[pos_++];
+        return true;
+    }
+
+    bool peek(uint8_t& out) const
+    {
+        if (pos_ >= size_)
+            return false;
+        out = data_[pos_];
+        return true;
+    }
+
+    bool skip(size_t count)
+    {
+        if (remaining() < count)
+            return false;
+        pos_ += count;
+        return true;
+    }
+
+    bool u16be(uint16_t& out)
+    {
+        uint8_t hi, lo;
+        if (!u8(hi) || !u8(lo))
+            return false;
+        out = static_cast<uint16_t>((hi << 8) | lo);
+        return true;
+    }
+
+    bool u32be(uint32_t& out)
+    {
+        uint16_t hi, lo;
+        if (!u16be(hi) || !u16be(lo))
+            return false;
+        out = (static_cast<uint32_t>(hi) << 16) | lo;
+        return true;
+    }
+
+    // MIDI variable-length quantity (7 bits per byte, high bit = continue)
+    bool vlq(uint32_t& out)
+    {
+        out = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            uint8_t byte;
+            if (!u8(byte))
+                return false;
+            out = (out << 7) | (byte & 0x7f);
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+bool parseTrack(ByteReader& track, int& order, std::vector<TickEvent>& out)
+{
+    uint64_t tick = 0;
+    uint8_t runningStatus = 0;
+
+    while (!track.done())
+    {
+        uint32_t delta;
+        if (!track.vlq(delta))
+            return false;
+        tick += delta;
+
+        uint8_t status;
+        if (!track.peek(status))
+            return false;
+        if (status & 0x80)
+            track.skip(1);
+        else if ((runningStatus & 0x80) != 0)
+            status = runningStatus;  // running status: reuse, data byte stays
+        else
+            return false;
+
+        if (status == 0xff)  // meta event
+        {
+            uint8_t type;
+            uint32_t length;
+            if (!track.u8(type) || !track.vlq(length) || track.remaining() < length)
+                return false;
+            if (type == 0x51 && length == 3)  // set tempo
+            {
+                uint8_t b0 = 0, b1 = 0, b2 = 0;
+                track.u8(b0); track.u8(b1); track.u8(b2);
+                TickEvent ev;
+                ev.tick = tick;
+                ev.order = order++;
+                ev.isTempo = true;
+                ev.tempoUsPerQuarter =
+                    (static_cast<uint32_t>(b0) << 16) | (static_cast<uint32_t>(b1) << 8) | b2;
+                out.push_back(ev);
+            }
+            else
+            {
+                if (type == 0x2f)  // end of track
+                    return true;
+                track.skip(length);
+            }
+            runningStatus = 0;  // meta/sysex cancel running status
+            continue;
+        }
+
+        if (status == 0xf0 || status == 0xf7)  // sysex: length-prefixed, skip
+        {
+            uint32_t length;
+            if (!track.vlq(length) || !track.skip(length))
+                return false;
+            runningStatus = 0;
+            continue;
+        }
+
+        runningStatus = status;
+        const uint8_t kind = status & 0xf0;
+        const uint8_t channel = status & 0x0f;
+
+        uint8_t d0 = 0, d1 = 0;
+        const bool twoBytes = kind != 0xc0 && kind != 0xd0;
+        if (!track.u8(d0) || (twoBytes && !track.u8(d1)))
+            return false;
+
+        TickEvent ev;
+        ev.tick = tick;
+        ev.order = order++;
+        ev.event.channel = channel;
+
+        switch (kind)
+        {
+            case 0x90:  // note on (velocity 0 is note off per the spec)
+                ev.event.kind = d1 > 0 ? MIDI_EVENT_NOTE_ON : MIDI_EVENT_NOTE_OFF;
+                ev.event.data = d0 & 0x7f;
+                ev.event.value = d1 / 127.0f;
+                out.push_back(ev);
+                break;
+            case 0x80:  // note off
+                ev.event.kind = MIDI_EVENT_NOTE_OFF;
+                ev.event.data = d0 & 0x7f;
+                out.push_back(ev);
+                break;
+            case 0xe0:  // pitch bend: 14-bit wheel mapped to +/-12 st, same
+            {           // convention as the plugin processors
+                const int wheel = ((d1 & 0x7f) << 7) | (d0 & 0x7f);
+                ev.event.kind = MIDI_EVENT_PITCH_BEND;
+                ev.event.value = (wheel - 8192) / 8192.0f * 12.0f;
+                out.push_back(ev);
+                break;
+            }
+            default:  // aftertouch, CC, program change: not bounced
+                break;
+        }
+    }
+    return true;
+}
+
+// Parses the whole file and converts the merged tempo-mapped tick stream to
+// absolute sample positions. Returns false (with a message) on malformed input.
+bool loadMidiFile(const char* path, double sampleRate, std::vector<TimedEvent>& out)
+{
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f)
+    {
+        std::fprintf(stderr, "error: cannot open MIDI file '%s'\n", path);
+        return false;
+    }
+    std::fseek(f, 0, SEEK_END);
+    const long fileSize = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    std::vector<uint8_t> bytes(fileSize > 0 ? static_cast<size_t>(fileSize) : 0);
+    const size_t bytesRead = bytes.empty() ? 0 : std::fread(bytes.data(), 1, bytes.size(), f);
+    std::fclose(f);
+    if (bytesRead != bytes.size() || bytes.size() < 14)
+    {
+        std::fprintf(stderr, "error: '%s' is not a MIDI file\n", path);
+        return false;
+    }
+
+    ByteReader reader(bytes.data(), bytes.size());
+    uint32_t magic, headerLength;
+    uint16_t format, numTracks, division;
+    if (!reader.u32be(magic) || magic != 0x4d546864  // "MThd"
+        || !reader.u32be(headerLength) || headerLength < 6
+        || !reader.u16be(format) || !reader.u16be(numTracks) || !reader.u16be(division)
+        || !reader.skip(headerLength - 6))
+    {
+        std::fprintf(stderr, "error: '%s' has no valid MThd header\n", path);
+        return false;
+    }
+    if (format > 1)
+    {
+        std::fprintf(stderr, "error: SMF format %d is not supported (use 0 or 1)\n", format);
+        return false;
+    }
+    if (division & 0x8000)
+    {
+        std::fprintf(stderr, "error: SMPTE time division is not supported\n");
+        return false;
+    }
+
+    std::vector<TickEvent> tickEvents;
+    int order = 0;
+    for (int t = 0; t < numTracks; ++t)
+    {
+        uint32_t chunkMagic, chunkLength;
+        if (!reader.u32be(chunkMagic) || !reader.u32be(chunkLength)
+            || reader.remaining() < chunkLength)
+        {
+            std::fprintf(stderr, "error: truncated track chunk in '%s'\n", path);
+            return false;
+        }
+        if (chunkMagic != 0x4d54726b)  // not "MTrk": alien chunk, skip
+        {
+            reader.skip(chunkLength);
+            continue;
+        }
+        ByteReader track(bytes.data() + (bytes.size() - reader.remaining()), chunkLength);
+        reader.skip(chunkLength);
+        if (!parseTrack(track, order, tickEvents))
+        {
+            std::fprintf(stderr, "error: malformed events in track %d of '%s'\n", t, path);
+            return false;
+        }
+    }
+
+    // Stable order: by tick, then file order, with tempo changes applied
+    // before the notes that share their tick
+    std::sort(tickEvents.begin(), tickEvents.end(), [](const TickEvent& a, const TickEvent& b) {
+        if (a.tick != b.tick)
+            return a.tick < b.tick;
+        if (a.isTempo != b.isTempo)
+            return a.isTempo;
+        return a.order < b.order;
+    });
+
+    // Walk the tempo map converting ticks to samples
+    double usPerQuarter = 500000.0;  // SMF default, 120 BPM
+    uint64_t lastTick = 0;
+    double samplePos = 0.0;
+    out.clear();
+    out.reserve(tickEvents.size());
+    for (const TickEvent& ev : tickEvents)
+    {
+        samplePos += static_cast<double>(ev.tick - lastTick)
+                   * usPerQuarter / division * sampleRate / 1.0e6;
+        lastTick = ev.tick;
+        if (ev.isTempo)
+        {
+            usPerQuarter = static_cast<double>(ev.tempoUsPerQuarter);
+            continue;
+        }
+        TimedEvent timed;
+        timed.samplePos = static_cast<uint64_t>(samplePos + 0.5);
+        timed.event = ev.event;
+        out.push_back(timed);
+    }
+    return true;
+}
+
+//==============================================================================
+// Streaming 32-bit float stereo WAV writer: header up front with placeholder
+// sizes, patched in close() once the sample count is known.
+
+class WavWriter
+{
+public:
+    bool open(const char* path, uint32_t sampleRate)
+    {
+        file_ = std::fopen(path, "wb");
+        if (!file_)
+        {
+            std::fprintf(stderr, "error: cannot open output file '%s'\n", path);
+            return false;
+        }
+
+        const uint32_t byteRate = sampleRate * kChannels * sizeof(float);
+        const uint16_t blockAlign = kChannels * sizeof(float);
+
+        std::fwrite("RIFF", 1, 4, file_);
+        writeU32(0);  // RIFF size, patched in close()
+        std::fwrite("WAVE", 1, 4, file_);
+        std::fwrite("fmt ", 1, 4, file_);
+        writeU32(16);
+        writeU16(3);  // IEEE float
+        writeU16(kChannels);
+        writeU32(sampleRate);
+        writeU32(byteRate);
+        writeU16(blockAlign);
+        writeU16(32);  // bits per sample
+        std::fwrite("data", 1, 4, file_);
+        writeU32(0);  // data size, patched in close()
+        return true;
+    }
+
+    void writeBlock(const float* left, const float* right, size_t numFrames)
+    {
+        interleaved_.resize(numFrames * kChannels);
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            interleaved_[2 * i] = left[i];
+            interleaved_[2 * i + 1] = right[i];
+        }
+        std::fwrite(interleaved_.data(), sizeof(float), interleaved_.size(), file_);
+        framesWritten_ += numFrames;
+    }
+
+    bool close()
+    {
+        if (!file_)
+            return false;
+        const uint32_t dataBytes =
+            static_cast<uint32_t>(framesWritten_ * kChannels * sizeof(float));
+        std::fseek(file_, 4, SEEK_SET);
+        writeU32(36 + dataBytes);
+        std::fseek(file_, 40, SEEK_SET);
+        writeU32(dataBytes);
+        const bool ok = std::fclose(file_) == 0;
+        file_ = nullptr;
+        return ok;
+    }
+
+    uint64_t framesWritten() const { return framesWritten_; }
+
+private:
+    static constexpr uint16_t kChannels = 2;
+
+    void writeU16(uint16_t v)
+    {
+        const uint8_t bytes[2] = { static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8) };
+        std::fwrite(bytes, 1, 2, file_);
+    }
+
+    void writeU32(uint32_t v)
+    {
+        const uint8_t bytes[4] = { static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8),
+                                   static_cast<uint8_t>(v >> 16), static_cast<uint8_t>(v >> 24) };
+        std::fwrite(bytes, 1, 4, file_);
+    }
+
+    std::FILE* file_ = nullptr;
+    std::vector<float> interleaved_;
+    uint64_t framesWritten_ = 0;
+};
+
+//==============================================================================
+
+// Reads a raw parameter-block file into `block`, insisting on an exact size
+// match so struct/file mismatches fail loudly instead of rendering garbage
+bool loadPresetBlock(const char* path, void* block, size_t blockSize, const char* engineName)
+{
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f)
+    {
+        std::fprintf(stderr, "error: cannot open preset file '%s'\n", path);
+        return false;
+    }
+    std::fseek(f, 0, SEEK_END);
+    const long fileSize = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    if (fileSize != static_cast<long>(blockSize))
+    {
+        std::fprintf(stderr,
+                     "error: '%s' is %ld bytes but a %s parameter block is %zu\n",
+                     path, fileSize, engineName, blockSize);
+        std::fclose(f);
+        return false;
+    }
+    const bool ok = std::fread(block, 1, blockSize, f) == blockSize;
+    std::fclose(f);
+    if (!ok)
+        std::fprintf(stderr, "error: short read on preset file '%s'\n", path);
+    return ok;
+}
+
+struct Options
+{
+    std::string engine;
+    std::string midiPath;
+    std::string presetPath;
+    std::string outPath;
+    double sampleRate = 48000.0;
+    int blockSize = 4096;
+    double tailSeconds = 30.0;
+    int numThreads = 1;
+};
+
+void usage()
+{
+    std::fprintf(stderr,
+        "usage: ossian19-render --engine fm|sub --midi in.mid --out out.wav\n"
+        "                       [--preset block.bin] [--rate 48000] [--block 4096]\n"
+        "                       [--tail 30] [--threads N]\n"
+        "\n"
+        "Renders a Standard MIDI File through the OSSIAN-19 FM or Sub engine\n"
+        "to a 32-bit float stereo WAV, faster than realtime. --preset takes a\n"
+        "raw FmParamBlock/SubParamBlock file; without it the default patch is\n"
+        "used. The render runs until the last release tail decays or --tail\n"
+        "seconds past the final event, whichever comes first.\n");
+}
+
+bool parseOptions(int argc, char** argv, Options& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--engine" && hasValue)
+            opts.engine = argv[++i];
+        else if (arg == "--midi" && hasValue)
+            opts.midiPath = argv[++i];
+        else if (arg == "--preset" && hasValue)
+            opts.presetPath = argv[++i];
+        else if (arg == "--out" && hasValue)
+            opts.outPath = argv[++i];
+        else if (arg == "--rate" && hasValue)
+            opts.sampleRate = std::atof(argv[++i]);
+        else if (arg == "--block" && hasValue)
+            opts.blockSize = std::atoi(argv[++i]);
+        else if (arg == "--tail" && hasValue)
+            opts.tailSeconds = std::atof(argv[++i]);
+        else if (arg == "--threads" && hasValue)
+            opts.numThreads = std::atoi(argv[++i]);
+        else
+        {
+            std::fprintf(stderr, "error: unknown or incomplete option '%s'\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if ((opts.engine != "fm" && opts.engine != "sub")
+        || opts.midiPath.empty() || opts.outPath.empty()
+        || opts.sampleRate < 8000.0 || opts.sampleRate > 192000.0
+        || opts.blockSize < 32 || opts.blockSize > 1 << 20)
+    {
+        usage();
+        return false;
+    }
+    return true;
+}
+
+// The render loop is engine-agnostic once process/activeVoices are bound;
+// both engines share the MidiEvent contract.
+template <typename ProcessEvents, typename ActiveVoices>
+bool render(const Options& opts, const std::vector<TimedEvent>& events,
+            ProcessEvents&& processEvents, ActiveVoices&& activeVoices)
+{
+    WavWriter wav;
+    if (!wav.open(opts.outPath.c_str(), static_cast<uint32_t>(opts.sampleRate)))
+        return false;
+
+    const size_t blockSize = static_cast<size_t>(opts.blockSize);
+    std::vector<float> left(blockSize), right(blockSize);
+    std::vector<MidiEvent> blockEvents;
+    blockEvents.reserve(256);
+
+    const uint64_t lastEventPos = events.empty() ? 0 : events.back().samplePos;
+    const uint64_t tailSamples =
+        static_cast<uint64_t>(opts.tailSeconds * opts.sampleRate);
+
+    uint64_t pos = 0;
+    size_t cursor = 0;
+    while (true)
+    {
+        blockEvents.clear();
+        while (cursor < events.size() && events[cursor].samplePos < pos + blockSize)
+        {
+            MidiEvent ev = events[cursor].event;
+            ev.sample_offset = static_cast<uint32_t>(events[cursor].samplePos - pos);
+            blockEvents.push_back(ev);
+            ++cursor;
+        }
+
+        processEvents(blockEvents.data(), blockEvents.size(),
+                      left.data(), right.data(), blockSize);
+        wav.writeBlock(left.data(), right.data(), blockSize);
+        pos += blockSize;
+
+        if (cursor >= events.size()
+            && (activeVoices() == 0 || pos >= lastEventPos + tailSamples))
+            break;
+    }
+
+    if (!wav.close())
+    {
+        std::fprintf(stderr, "error: failed to finalize '%s'\n", opts.outPath.c_str());
+        return false;
+    }
+
+    std::printf("%s: %llu frames (%.2fs) at %.0f Hz, %zu events\n",
+                opts.outPath.c_str(),
+                static_cast<unsigned long long>(wav.framesWritten()),
+                static_cast<double>(wav.framesWritten()) / opts.sampleRate,
+                opts.sampleRate, events.size());
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opts;
+    if (!parseOptions(argc, argv, opts))
+        return 1;
+
+    std::vector<TimedEvent> events;
+    if (!loadMidiFile(opts.midiPath.c_str(), opts.sampleRate, events))
+        return 1;
+
+    ossian19_tables_init();
+    bool ok = false;
+
+    if (opts.engine == "fm")
+    {
+        FmParamBlock preset {};
+        const bool havePreset = !opts.presetPath.empty();
+        if (havePreset
+            && !loadPresetBlock(opts.presetPath.c_str(), &preset, sizeof(preset), "FM"))
+            return 1;
+
+        FmSynthHandle synth = fm_synth_create(static_cast<float>(opts.sampleRate));
+        fm_synth_set_offline(synth, true);
+        fm_synth_set_num_threads(synth, opts.numThreads);
+        fm_synth_prewarm(synth, opts.blockSize);
+        if (havePreset)
+            fm_synth_apply_preset(synth, &preset, true);
+
+        ok = render(opts, events,
+            [synth](const MidiEvent* ev, size_t n, float* l, float* r, size_t samples) {
+                fm_synth_process_events(synth, ev, n, l, r, samples);
+            },
+            [synth]() { return fm_synth_active_voices(synth); });
+        fm_synth_destroy(synth);
+    }
+    else
+    {
+        SubParamBlock preset {};
+        const bool havePreset = !opts.presetPath.empty();
+        if (havePreset
+            && !loadPresetBlock(opts.presetPath.c_str(), &preset, sizeof(preset), "Sub"))
+            return 1;
+
+        SubSynthHandle synth = sub_synth_create(static_cast<float>(opts.sampleRate));
+        sub_synth_set_offline(synth, true);
+        sub_synth_set_num_threads(synth, opts.numThreads);
+        sub_synth_prewarm(synth, opts.blockSize);
+        if (havePreset)
+            sub_synth_apply_preset(synth, &preset, true);
+
+        ok = render(opts, events,
+            [synth](const MidiEvent* ev, size_t n, float* l, float* r, size_t samples) {
+                sub_synth_process_events(synth, ev, n, l, r, samples);
+            },
+            [synth]() { return sub_synth_active_voices(synth); });
+        sub_synth_destroy(synth);
+    }
+
+    return ok ? 0 : 1;
+}
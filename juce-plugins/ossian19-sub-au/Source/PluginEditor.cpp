@@ -242,6 +242,10 @@ void Ossian19SubEditor::createControls()
 
     masterVol = std::make_unique<RotaryKnob>(*vts.getParameter("master_vol"), vts, "VOLUME", juce::Colour(MASTER_COLOR));
     addAndMakeVisible(masterVol.get());
+
+    // CPU / voice meter
+    telemetryMeter = std::make_unique<TelemetryMeter>(processor.getTelemetry());
+    addAndMakeVisible(telemetryMeter.get());
 }
 
 void Ossian19SubEditor::paint(juce::Graphics& g)
@@ -377,4 +381,7 @@ void Ossian19SubEditor::resized()
     int masterW = knobW + 20;
     masterSection->setBounds(x, y, masterW, sectionH);
     masterVol->setBounds(x + 10, envY, knobW, knobH);
+
+    // CPU / voice meter (top-right, clear of the title)
+    telemetryMeter->setBounds(getWidth() - 210, 10, 200, 36);
 }
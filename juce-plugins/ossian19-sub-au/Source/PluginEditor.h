@@ -144,6 +144,9 @@ private:
     // Knobs - Master
     std::unique_ptr<RotaryKnob> masterVol;
 
+    // CPU / voice meter fed by the processor's telemetry ring
+    std::unique_ptr<TelemetryMeter> telemetryMeter;
+
     void createControls();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Ossian19SubEditor)
@@ -1,20 +1,81 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+// This TU hosts the audit-mode operator new/delete replacements (no-op
+// unless the target is built with OSSIAN19_AUDIT_ALLOCATIONS=1)
+#define OSSIAN19_AUDIT_ALLOCATIONS_IMPL 1
+#include "AllocationAudit.h"
+
 Ossian19SubProcessor::Ossian19SubProcessor()
     : AudioProcessor(BusesProperties()
         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "OSSIAN19SUB", createParameterLayout())
 {
     synthHandle = sub_synth_create(44100.0f);
+    midiEvents.reserve(1024);
+
+    // Register change listeners so processBlock() only pushes modified
+    // parameters over the FFI instead of the full set every block.
+    registerParamBit(OSC1_WAVE, kBitOsc1Wave);
+    registerParamBit(OSC1_LEVEL, kBitOsc1Level);
+    registerParamBit(OSC2_WAVE, kBitOsc2Wave);
+    registerParamBit(OSC2_LEVEL, kBitOsc2Level);
+    registerParamBit(OSC2_DETUNE, kBitOsc2Detune);
+    registerParamBit(SUB_WAVE, kBitSubWave);
+    registerParamBit(SUB_LEVEL, kBitSubLevel);
+    registerParamBit(SUB_OCTAVE, kBitSubOctave);
+    registerParamBit(NOISE_LEVEL, kBitNoiseLevel);
+    registerParamBit(PULSE_WIDTH, kBitPulseWidth);
+    registerParamBit(PWM_DEPTH, kBitPwmDepth);
+    registerParamBit(PWM_RATE, kBitPwmRate);
+    registerParamBit(FM_AMOUNT, kBitFmAmount);
+    registerParamBit(FM_RATIO, kBitFmRatio);
+    registerParamBit(UNISON_VOICES, kBitUnisonVoices);
+    registerParamBit(UNISON_DETUNE, kBitUnisonDetune);
+    registerParamBit(UNISON_SPREAD, kBitUnisonSpread);
+    registerParamBit(FILTER_CUTOFF, kBitFilterCutoff);
+    registerParamBit(FILTER_RESO, kBitFilterReso);
+    registerParamBit(FILTER_SLOPE, kBitFilterSlope);
+    registerParamBit(FILTER_ENV, kBitFilterEnv);
+    registerParamBit(HPF_CUTOFF, kBitHpfCutoff);
+    registerParamBit(AMP_A, kBitAmpA);
+    registerParamBit(AMP_D, kBitAmpD);
+    registerParamBit(AMP_S, kBitAmpS);
+    registerParamBit(AMP_R, kBitAmpR);
+    registerParamBit(FLT_A, kBitFltA);
+    registerParamBit(FLT_D, kBitFltD);
+    registerParamBit(FLT_S, kBitFltS);
+    registerParamBit(FLT_R, kBitFltR);
+    registerParamBit(MASTER_VOL, kBitMasterVol);
+    registerParamBit(POLYPHONY, kBitPolyphony);
+    registerParamBit(STEAL_MODE, kBitStealMode);
 }
 
 Ossian19SubProcessor::~Ossian19SubProcessor()
 {
+    for (const auto& entry : paramBitById)
+        parameters.removeParameterListener(entry.first, this);
+
+    if (registeredPoolClient)
+        renderCoordinator->removePoolClient();
+
     if (synthHandle)
         sub_synth_destroy(synthHandle);
 }
 
+void Ossian19SubProcessor::registerParamBit(const juce::String& paramID, int bitIndex)
+{
+    paramBitById[paramID] = bitIndex;
+    parameters.addParameterListener(paramID, this);
+}
+
+void Ossian19SubProcessor::parameterChanged(const juce::String& parameterID, float /*newValue*/)
+{
+    auto it = paramBitById.find(parameterID);
+    if (it != paramBitById.end())
+        dirtyParams.fetch_or(bit(it->second), std::memory_order_release);
+}
+
 juce::AudioProcessorValueTreeState::ParameterLayout Ossian19SubProcessor::createParameterLayout()
 {
     std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
@@ -61,6 +122,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout Ossian19SubProcessor::create
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{FM_RATIO, 1}, "FM Ratio", 0.25f, 8.0f, 2.0f));
 
+    // Unison / supersaw: all copies render inside the engine voice and share
+    // one filter chain, so this replaces stacking plugin instances
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID{UNISON_VOICES, 1}, "Unison Voices", 1, 7, 1));
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{UNISON_DETUNE, 1}, "Unison Detune", 0.0f, 100.0f, 25.0f));
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{UNISON_SPREAD, 1}, "Unison Spread", 0.0f, 1.0f, 0.7f));
+
     // Filter
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{FILTER_CUTOFF, 1}, "Cutoff",
@@ -106,76 +176,302 @@ juce::AudioProcessorValueTreeState::ParameterLayout Ossian19SubProcessor::create
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{MASTER_VOL, 1}, "Volume", 0.0f, 1.0f, 0.7f));
 
+    // Voice allocation (automatable so the CPU budget can be ridden per track)
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID{POLYPHONY, 1}, "Polyphony", 1, 32, 8));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{STEAL_MODE, 1}, "Voice Steal",
+        juce::StringArray{"Oldest", "Quietest", "Same Note"}, 0));
+
+    // CPU budget threshold as a fraction of the block deadline; 0 = off.
+    // Above it the processor sheds quiet release-phase voices instead of
+    // dropping buffers. Appended after the original layout so
+    // count-prefixed state blobs stay compatible.
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{BUDGET, 1}, "CPU Budget",
+        juce::NormalisableRange<float>(0.0f, 0.95f, 0.0f), 0.0f));
+
     return {params.begin(), params.end()};
 }
 
-void Ossian19SubProcessor::prepareToPlay(double sampleRate, int /*samplesPerBlock*/)
+void Ossian19SubProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    if (synthHandle)
-        sub_synth_set_sample_rate(synthHandle, static_cast<float>(sampleRate));
+    if (!synthHandle)
+        return;
+
+    sub_synth_set_sample_rate(synthHandle, static_cast<float>(sampleRate));
+
+    preparedBlockSize = samplesPerBlock;
+
+    // Engine-side scratch sized up front so the audio path never allocates
+    sub_synth_prewarm(synthHandle, juce::jmax(1, samplesPerBlock));
+
+    updateRenderThreading();
+}
+
+void Ossian19SubProcessor::setNonRealtime(bool isNonRealtime) noexcept
+{
+    AudioProcessor::setNonRealtime(isNonRealtime);
+    updateRenderThreading();
+}
+
+void Ossian19SubProcessor::updateRenderThreading()
+{
+    if (!synthHandle)
+        return;
+
+    sub_synth_set_offline(synthHandle, isNonRealtime());
+
+    // Realtime, worker-pool rendering only pays off once the block is large
+    // enough to amortize the fork/join. Offline bounces care about throughput
+    // alone, so they always get the pool. Instances that qualify register
+    // with the process-wide coordinator, which splits the core budget
+    // across everyone instead of letting each instance size its pool as if
+    // it were alone.
+    const bool wantsPool = isNonRealtime() || preparedBlockSize >= 512;
+    if (wantsPool != registeredPoolClient)
+    {
+        if (wantsPool)
+            renderCoordinator->addPoolClient();
+        else
+            renderCoordinator->removePoolClient();
+        registeredPoolClient = wantsPool;
+    }
+
+    // Size the engine's persistent worker pool for the largest share the
+    // coordinator could ever hand us. The pool grows but never shrinks, so
+    // spawning happens here (message thread) and the render-thread re-split
+    // poll in processBlock() only ever changes how many workers get used.
+    if (registeredPoolClient)
+        sub_synth_set_num_threads(synthHandle, renderCoordinator->maxThreadsPerClient());
+
+    applyThreadBudget();
+}
+
+void Ossian19SubProcessor::applyThreadBudget()
+{
+    // Read the generation before the share so a re-split racing this call is
+    // picked up again at the next block rather than missed.
+    appliedThreadGeneration = renderCoordinator->currentGeneration();
+    const int numThreads = !registeredPoolClient ? 1
+        : isNonRealtime() ? renderCoordinator->offlineThreadsPerClient()
+                          : renderCoordinator->realtimeThreadsPerClient();
+    sub_synth_set_num_threads(synthHandle, numThreads);
 }
 
 void Ossian19SubProcessor::releaseResources()
 {
     if (synthHandle)
         sub_synth_all_notes_off(synthHandle);
+
+    // Give our slice of the process-wide thread budget back while idle;
+    // prepareToPlay() re-registers
+    if (registeredPoolClient)
+    {
+        renderCoordinator->removePoolClient();
+        registeredPoolClient = false;
+    }
 }
 
-void Ossian19SubProcessor::applyParameters()
+void Ossian19SubProcessor::loadPreset(const std::vector<std::pair<juce::String, float>>& normalizedValues)
 {
-    if (!synthHandle) return;
+    for (const auto& [paramID, value] : normalizedValues)
+        if (auto* param = parameters.getParameter(paramID))
+            param->setValueNotifyingHost(value);
 
-    // Oscillators
-    sub_synth_set_osc1_waveform(synthHandle, static_cast<int32_t>(*parameters.getRawParameterValue(OSC1_WAVE)));
-    sub_synth_set_osc1_level(synthHandle, *parameters.getRawParameterValue(OSC1_LEVEL));
-    sub_synth_set_osc2_waveform(synthHandle, static_cast<int32_t>(*parameters.getRawParameterValue(OSC2_WAVE)));
-    sub_synth_set_osc2_level(synthHandle, *parameters.getRawParameterValue(OSC2_LEVEL));
-    sub_synth_set_osc2_detune(synthHandle, *parameters.getRawParameterValue(OSC2_DETUNE));
+    // The listener callbacks above marked everything they touched dirty;
+    // supersede them with a single engine-side preset apply on the next block.
+    presetPending = true;
+}
 
-    // Sub Oscillator
-    sub_synth_set_sub_waveform(synthHandle, static_cast<int32_t>(*parameters.getRawParameterValue(SUB_WAVE)));
-    sub_synth_set_sub_level(synthHandle, *parameters.getRawParameterValue(SUB_LEVEL));
-    sub_synth_set_sub_octave(synthHandle, static_cast<int32_t>(*parameters.getRawParameterValue(SUB_OCTAVE)));
+void Ossian19SubProcessor::buildProgramBlock(
+    const std::vector<std::pair<juce::String, float>>& normalizedValues,
+    SubParamBlock& block) const
+{
+    // Denormalize through each parameter's own range so the block holds the
+    // same engine values applyParameters() would produce; parameters absent
+    // from the program keep their current value.
+    auto value = [this, &normalizedValues](const juce::String& paramID) -> float
+    {
+        auto* param = parameters.getParameter(paramID);
+        for (const auto& [id, normalized] : normalizedValues)
+            if (id == paramID)
+                return param != nullptr ? param->convertFrom0to1(normalized) : normalized;
+        return *parameters.getRawParameterValue(paramID);
+    };
+
+    block.dirty_mask = ~0ull;
+
+    block.osc1_waveform = static_cast<int32_t>(value(OSC1_WAVE));
+    block.osc1_level    = value(OSC1_LEVEL);
+    block.osc2_waveform = static_cast<int32_t>(value(OSC2_WAVE));
+    block.osc2_level    = value(OSC2_LEVEL);
+    block.osc2_detune   = value(OSC2_DETUNE);
+
+    block.sub_waveform = static_cast<int32_t>(value(SUB_WAVE));
+    block.sub_level    = value(SUB_LEVEL);
+    block.sub_octave   = static_cast<int32_t>(value(SUB_OCTAVE));
+
+    block.noise_level = value(NOISE_LEVEL);
+
+    block.pulse_width = value(PULSE_WIDTH);
+    block.pwm_depth   = value(PWM_DEPTH);
+    block.pwm_rate    = value(PWM_RATE);
+
+    block.fm_amount = value(FM_AMOUNT);
+    block.fm_ratio  = value(FM_RATIO);
+
+    block.filter_cutoff     = value(FILTER_CUTOFF);
+    block.filter_resonance  = value(FILTER_RESO);
+    block.filter_slope      = static_cast<int32_t>(value(FILTER_SLOPE));
+    block.filter_env_amount = value(FILTER_ENV);
+    block.hpf_cutoff        = value(HPF_CUTOFF);
+
+    block.amp_attack  = value(AMP_A);
+    block.amp_decay   = value(AMP_D);
+    block.amp_sustain = value(AMP_S);
+    block.amp_release = value(AMP_R);
+
+    block.filter_attack  = value(FLT_A);
+    block.filter_decay   = value(FLT_D);
+    block.filter_sustain = value(FLT_S);
+    block.filter_release = value(FLT_R);
+
+    block.master_volume = value(MASTER_VOL);
+
+    block.unison_voices = static_cast<int32_t>(value(UNISON_VOICES));
+    block.unison_detune = value(UNISON_DETUNE);
+    block.unison_spread = value(UNISON_SPREAD);
+}
 
-    // Noise
-    sub_synth_set_noise_level(synthHandle, *parameters.getRawParameterValue(NOISE_LEVEL));
+void Ossian19SubProcessor::setProgramBank(
+    const std::vector<std::vector<std::pair<juce::String, float>>>& programs)
+{
+    // Decode outside the lock; the audio thread only ever trylocks, so the
+    // lock is held just long enough to swap the slots in.
+    std::vector<ProgramSlot> decoded(juce::jmin((size_t)kNumPrograms, programs.size()));
+    for (size_t i = 0; i < decoded.size(); ++i)
+    {
+        buildProgramBlock(programs[i], decoded[i].block);
+        decoded[i].normalized = programs[i];
+        decoded[i].valid = true;
+    }
 
-    // PWM
-    sub_synth_set_pulse_width(synthHandle, *parameters.getRawParameterValue(PULSE_WIDTH));
-    sub_synth_set_pwm_depth(synthHandle, *parameters.getRawParameterValue(PWM_DEPTH));
-    sub_synth_set_pwm_rate(synthHandle, *parameters.getRawParameterValue(PWM_RATE));
+    const juce::SpinLock::ScopedLockType lock(programLock);
+    for (size_t i = 0; i < decoded.size(); ++i)
+        programBank[i] = std::move(decoded[i]);
+}
 
-    // FM
-    sub_synth_set_fm_amount(synthHandle, *parameters.getRawParameterValue(FM_AMOUNT));
-    sub_synth_set_fm_ratio(synthHandle, *parameters.getRawParameterValue(FM_RATIO));
+void Ossian19SubProcessor::applyProgramChange(int programIndex)
+{
+    if (programIndex < 0 || programIndex >= kNumPrograms)
+        return;
 
-    // Filter
-    sub_synth_set_filter_cutoff(synthHandle, *parameters.getRawParameterValue(FILTER_CUTOFF));
-    sub_synth_set_filter_resonance(synthHandle, *parameters.getRawParameterValue(FILTER_RESO));
-    sub_synth_set_filter_slope(synthHandle, static_cast<int32_t>(*parameters.getRawParameterValue(FILTER_SLOPE)));
-    sub_synth_set_filter_env_amount(synthHandle, *parameters.getRawParameterValue(FILTER_ENV));
-    sub_synth_set_hpf_cutoff(synthHandle, *parameters.getRawParameterValue(HPF_CUTOFF));
-
-    // Envelopes
-    sub_synth_set_amp_adsr(synthHandle,
-        *parameters.getRawParameterValue(AMP_A),
-        *parameters.getRawParameterValue(AMP_D),
-        *parameters.getRawParameterValue(AMP_S),
-        *parameters.getRawParameterValue(AMP_R));
-
-    sub_synth_set_filter_adsr(synthHandle,
-        *parameters.getRawParameterValue(FLT_A),
-        *parameters.getRawParameterValue(FLT_D),
-        *parameters.getRawParameterValue(FLT_S),
-        *parameters.getRawParameterValue(FLT_R));
+    // Never block the audio thread: if the bank is being rebuilt right now,
+    // drop the program change rather than wait.
+    const juce::SpinLock::ScopedTryLockType lock(programLock);
+    if (!lock.isLocked() || !programBank[(size_t)programIndex].valid)
+        return;
 
-    // Master
-    sub_synth_set_master_volume(synthHandle, *parameters.getRawParameterValue(MASTER_VOL));
+    // kill_voices=false: live patch switching should let old notes ring out
+    // under the new patch rather than chopping their tails.
+    sub_synth_apply_preset(synthHandle, &programBank[(size_t)programIndex].block, false);
+
+    // Sync the APVTS on the message thread so host/UI state catches up; the
+    // listener callbacks will re-push the same values, which the engine
+    // treats as a no-op.
+    lastProgramApplied.store(programIndex, std::memory_order_release);
+    triggerAsyncUpdate();
+}
+
+void Ossian19SubProcessor::handleAsyncUpdate()
+{
+    const int programIndex = lastProgramApplied.load(std::memory_order_acquire);
+    if (programIndex < 0 || programIndex >= kNumPrograms)
+        return;
+
+    std::vector<std::pair<juce::String, float>> values;
+    {
+        const juce::SpinLock::ScopedLockType lock(programLock);
+        if (!programBank[(size_t)programIndex].valid)
+            return;
+        values = programBank[(size_t)programIndex].normalized;
+    }
+    for (const auto& [paramID, value] : values)
+        if (auto* param = parameters.getParameter(paramID))
+            param->setValueNotifyingHost(value);
+}
+
+void Ossian19SubProcessor::applyParameters(uint64_t dirtyBits, bool asPreset)
+{
+    if (!synthHandle) return;
+
+    // Fill one cache-friendly block and cross the FFI boundary once; the
+    // engine applies every flagged field before rendering the next sample.
+    // The ParamBit layout matches the SubParamBlock dirty_mask contract.
+    SubParamBlock block;
+    block.dirty_mask = dirtyBits;
+
+    block.osc1_waveform = static_cast<int32_t>(*parameters.getRawParameterValue(OSC1_WAVE));
+    block.osc1_level    = *parameters.getRawParameterValue(OSC1_LEVEL);
+    block.osc2_waveform = static_cast<int32_t>(*parameters.getRawParameterValue(OSC2_WAVE));
+    block.osc2_level    = *parameters.getRawParameterValue(OSC2_LEVEL);
+    block.osc2_detune   = *parameters.getRawParameterValue(OSC2_DETUNE);
+
+    block.sub_waveform = static_cast<int32_t>(*parameters.getRawParameterValue(SUB_WAVE));
+    block.sub_level    = *parameters.getRawParameterValue(SUB_LEVEL);
+    block.sub_octave   = static_cast<int32_t>(*parameters.getRawParameterValue(SUB_OCTAVE));
+
+    block.noise_level = *parameters.getRawParameterValue(NOISE_LEVEL);
+
+    block.pulse_width = *parameters.getRawParameterValue(PULSE_WIDTH);
+    block.pwm_depth   = *parameters.getRawParameterValue(PWM_DEPTH);
+    block.pwm_rate    = *parameters.getRawParameterValue(PWM_RATE);
+
+    block.fm_amount = *parameters.getRawParameterValue(FM_AMOUNT);
+    block.fm_ratio  = *parameters.getRawParameterValue(FM_RATIO);
+
+    block.filter_cutoff     = *parameters.getRawParameterValue(FILTER_CUTOFF);
+    block.filter_resonance  = *parameters.getRawParameterValue(FILTER_RESO);
+    block.filter_slope      = static_cast<int32_t>(*parameters.getRawParameterValue(FILTER_SLOPE));
+    block.filter_env_amount = *parameters.getRawParameterValue(FILTER_ENV);
+    block.hpf_cutoff        = *parameters.getRawParameterValue(HPF_CUTOFF);
+
+    block.amp_attack  = *parameters.getRawParameterValue(AMP_A);
+    block.amp_decay   = *parameters.getRawParameterValue(AMP_D);
+    block.amp_sustain = *parameters.getRawParameterValue(AMP_S);
+    block.amp_release = *parameters.getRawParameterValue(AMP_R);
+
+    block.filter_attack  = *parameters.getRawParameterValue(FLT_A);
+    block.filter_decay   = *parameters.getRawParameterValue(FLT_D);
+    block.filter_sustain = *parameters.getRawParameterValue(FLT_S);
+    block.filter_release = *parameters.getRawParameterValue(FLT_R);
+
+    block.master_volume = *parameters.getRawParameterValue(MASTER_VOL);
+
+    block.unison_voices = static_cast<int32_t>(*parameters.getRawParameterValue(UNISON_VOICES));
+    block.unison_detune = *parameters.getRawParameterValue(UNISON_DETUNE);
+    block.unison_spread = *parameters.getRawParameterValue(UNISON_SPREAD);
+
+    if (asPreset)
+        sub_synth_apply_preset(synthHandle, &block, true);
+    else
+        sub_synth_apply_params(synthHandle, &block);
+
+    // Voice allocation is not part of the block; it has dedicated setters
+    if (dirtyBits & bit(kBitPolyphony))
+        sub_synth_set_max_polyphony(synthHandle,
+            static_cast<int32_t>(*parameters.getRawParameterValue(POLYPHONY)));
+    if (dirtyBits & bit(kBitStealMode))
+        sub_synth_set_steal_policy(synthHandle,
+            static_cast<int32_t>(*parameters.getRawParameterValue(STEAL_MODE)));
 }
 
 void Ossian19SubProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    [[maybe_unused]] allocation_audit::ScopedAudit allocationAudit;
+    const auto renderStart = juce::Time::getHighResolutionTicks();
 
     if (!synthHandle)
     {
@@ -183,41 +479,162 @@ void Ossian19SubProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
         return;
     }
 
-    // Apply parameter changes
-    applyParameters();
-
-    // Process MIDI
+    // Apply parameter changes (only what changed since the last block).
+    // A pending preset supersedes individual dirty bits: the whole patch is
+    // pushed in one engine call, with sounding voices killed first.
+    const bool presetNow = presetPending.exchange(false);
+    uint64_t dirty = dirtyParams.exchange(0, std::memory_order_acq_rel);
+    if (fullPushPending.exchange(false) || presetNow)
+        dirty = ~0ull;
+    if (dirty != 0)
+        applyParameters(dirty, presetNow);
+
+    // Other instances registering or leaving re-split the process-wide
+    // thread budget; pick up our new share. Applied here so the split only
+    // ever changes on the thread that renders; the worker pool itself was
+    // sized for the maximum share at prepare time, so this never spawns.
+    if (registeredPoolClient
+        && renderCoordinator->currentGeneration() != appliedThreadGeneration)
+        applyThreadBudget();
+
+    // Convert MIDI to sample-accurate engine events. Program changes are
+    // kept out of the event stream: they are applied host-side between
+    // render segments against the preloaded program bank.
+    struct PendingProgramChange { int offset; int program; };
+    PendingProgramChange programChanges[kMaxProgramChangesPerBlock];
+    int numProgramChanges = 0;
+
+    midiEvents.clear();
     for (const auto metadata : midiMessages)
     {
         auto message = metadata.getMessage();
 
+        MidiEvent event {};
+        event.sample_offset = static_cast<uint32_t>(juce::jmax(0, metadata.samplePosition));
+        event.channel = static_cast<uint8_t>(juce::jmax(0, message.getChannel() - 1));
+
         if (message.isNoteOn())
         {
-            sub_synth_note_on(synthHandle,
-                static_cast<uint8_t>(message.getNoteNumber()),
-                message.getFloatVelocity());
+            event.kind = MIDI_EVENT_NOTE_ON;
+            event.data = static_cast<uint8_t>(message.getNoteNumber());
+            event.value = message.getFloatVelocity();
         }
         else if (message.isNoteOff())
         {
-            sub_synth_note_off(synthHandle,
-                static_cast<uint8_t>(message.getNoteNumber()));
+            event.kind = MIDI_EVENT_NOTE_OFF;
+            event.data = static_cast<uint8_t>(message.getNoteNumber());
         }
         else if (message.isPitchWheel())
         {
-            float bend = (message.getPitchWheelValue() - 8192) / 8192.0f * 12.0f;
-            sub_synth_set_pitch_bend(synthHandle, bend);
+            event.kind = MIDI_EVENT_PITCH_BEND;
+            event.value = (message.getPitchWheelValue() - 8192) / 8192.0f * 12.0f;
+        }
+        else if (message.isProgramChange())
+        {
+            if (numProgramChanges < kMaxProgramChangesPerBlock)
+                programChanges[numProgramChanges++] =
+                    { juce::jmax(0, metadata.samplePosition), message.getProgramChangeNumber() };
+            continue;
         }
         else if (message.isAllNotesOff() || message.isAllSoundOff())
         {
-            sub_synth_all_notes_off(synthHandle);
+            event.kind = MIDI_EVENT_ALL_NOTES_OFF;
         }
+        else
+        {
+            continue;
+        }
+
+        midiEvents.push_back(event);
     }
 
-    // Process audio
+    // Process audio, applying each event at its exact sample position.
+    // Mono bus layouts take the dedicated mono path instead of rendering
+    // the same signal into one buffer twice. The block is cut into one
+    // segment per program change so the new patch takes effect at its
+    // sample position; without program changes this is one engine call.
     auto* leftChannel = buffer.getWritePointer(0);
-    auto* rightChannel = buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : leftChannel;
+    const int numFrames = buffer.getNumSamples();
+
+    int cursor = 0;
+    size_t eventCursor = 0;
+    auto renderUpTo = [&](int end)
+    {
+        end = juce::jlimit(cursor, numFrames, end);
+        if (end <= cursor)
+            return;
+        const size_t firstEvent = eventCursor;
+        while (eventCursor < midiEvents.size()
+               && static_cast<int>(midiEvents[eventCursor].sample_offset) < end)
+        {
+            midiEvents[eventCursor].sample_offset = static_cast<uint32_t>(
+                static_cast<int>(midiEvents[eventCursor].sample_offset) - cursor);
+            ++eventCursor;
+        }
+        const auto len = static_cast<size_t>(end - cursor);
+        if (buffer.getNumChannels() == 1)
+        {
+            sub_synth_process_events_mono(synthHandle, midiEvents.data() + firstEvent,
+                                          eventCursor - firstEvent, leftChannel + cursor, len);
+        }
+        else
+        {
+            sub_synth_process_events(synthHandle, midiEvents.data() + firstEvent,
+                                     eventCursor - firstEvent, leftChannel + cursor,
+                                     buffer.getWritePointer(1) + cursor, len);
+        }
+        cursor = end;
+    };
+
+    for (int i = 0; i < numProgramChanges; ++i)
+    {
+        renderUpTo(programChanges[i].offset);
+        applyProgramChange(programChanges[i].program);
+    }
+    renderUpTo(numFrames);
+
+    // Telemetry for the editor's CPU/voice meter: wait-free push, no locks
+    // or allocation on the audio path. Meaningless (and pure overhead)
+    // during an offline bounce, so skipped there.
+    if (!isNonRealtime())
+    {
+        const int numSamples = buffer.getNumSamples();
+        TelemetryFrame frame;
+        frame.renderTimeMs = static_cast<float>(juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - renderStart)) * 1000.0f;
+        frame.blockDurationMs = getSampleRate() > 0.0
+            ? static_cast<float>(numSamples / getSampleRate() * 1000.0) : 0.0f;
+        frame.peakLeft = buffer.getMagnitude(0, 0, numSamples);
+        frame.peakRight = buffer.getNumChannels() > 1
+            ? buffer.getMagnitude(1, 0, numSamples) : frame.peakLeft;
+        frame.activeVoices = sub_synth_active_voices(synthHandle);
+        telemetry.push(frame);
+
+        // CPU budgeter: when the smoothed load crosses the threshold, shed
+        // the quietest release-phase voices (the engine collapses their
+        // remaining release to ~20 ms) until pressure clears. One-pole
+        // smoothing keeps a single slow block from triggering it; the
+        // lower exit threshold keeps it from flapping around the limit.
+        const float budgetThreshold = *parameters.getRawParameterValue(BUDGET);
+        if (budgetThreshold > 0.0f && frame.blockDurationMs > 0.0f)
+        {
+            const float load = frame.renderTimeMs / frame.blockDurationMs;
+            smoothedLoad = smoothedLoad * 0.8f + load * 0.2f;
+
+            if (smoothedLoad > budgetThreshold)
+                budgetPressure = true;
+            else if (smoothedLoad < budgetThreshold * 0.7f)
+                budgetPressure = false;
 
-    sub_synth_process(synthHandle, leftChannel, rightChannel, static_cast<size_t>(buffer.getNumSamples()));
+            if (budgetPressure)
+                sub_synth_shed_voices(synthHandle, 2);
+        }
+        else
+        {
+            smoothedLoad = 0.0f;
+            budgetPressure = false;
+        }
+    }
 }
 
 juce::AudioProcessorEditor* Ossian19SubProcessor::createEditor()
@@ -227,16 +644,54 @@ juce::AudioProcessorEditor* Ossian19SubProcessor::createEditor()
 
 void Ossian19SubProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = parameters.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    // Versioned little-endian binary blob: fixed header followed by the
+    // normalized parameter values in layout order. Orders of magnitude
+    // cheaper than the old XML round-trip when a session holds dozens of
+    // instances or the host autosaves.
+    juce::MemoryOutputStream out(destData, false);
+    const auto& params = getParameters();
+
+    out.writeInt(kStateMagic);
+    out.writeInt(kStateVersion);
+    out.writeInt(params.size());
+    for (auto* param : params)
+        out.writeFloat(param->getValue());
 }
 
 void Ossian19SubProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    juce::MemoryInputStream in(data, static_cast<size_t>(sizeInBytes), false);
+
+    if (sizeInBytes >= 12 && in.readInt() == kStateMagic)
+    {
+        const int version = in.readInt();
+        if (version > kStateVersion)
+            return; // written by a newer build; don't guess
+
+        const int count = in.readInt();
+        const auto& params = getParameters();
+        for (int i = 0; i < count && !in.isExhausted(); ++i)
+        {
+            const float value = in.readFloat();
+            // Diff against the live value: untouched parameters fire no
+            // listeners and set no dirty bits, so an unchanged instance on
+            // session load — or a host undo of a single knob — costs only
+            // what actually moved instead of a full ~27-value re-push.
+            // Values round-trip bit-exactly through the blob (getValue()
+            // was what got written), so an exact compare is enough.
+            if (i < params.size() && params[i]->getValue() != value)
+                params[i]->setValueNotifyingHost(value);
+        }
+        return;
+    }
+
+    // Fallback reader for sessions saved by the XML-based versions
     std::unique_ptr<juce::XmlElement> xml(getXmlFromBinary(data, sizeInBytes));
     if (xml && xml->hasTagName(parameters.state.getType()))
+    {
         parameters.replaceState(juce::ValueTree::fromXml(*xml));
+        fullPushPending = true;
+    }
 }
 
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
@@ -1,9 +1,18 @@
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <atomic>
+#include <map>
+#include <vector>
 #include "ossian19.h"
+#include "Telemetry.h"
+#include "SharedEngineTables.h"
+#include "RenderCoordinator.h"
 
-class Ossian19SubProcessor : public juce::AudioProcessor
+class Ossian19SubProcessor : public juce::AudioProcessor,
+                             private juce::AudioProcessorValueTreeState::Listener,
+                             private juce::AsyncUpdater
 {
 public:
     Ossian19SubProcessor();
@@ -12,6 +21,7 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void setNonRealtime(bool isNonRealtime) noexcept override;
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -32,8 +42,26 @@ public:
 
     // Parameters
     juce::AudioProcessorValueTreeState& getValueTreeState() { return parameters; }
+    TelemetryRing& getTelemetry() { return telemetry; }
+
+    // Atomically loads a full patch: writes the normalized values to the
+    // APVTS (host and UI stay in sync) and schedules one engine-side preset
+    // apply with voice kill for the next block, instead of letting the
+    // listener callbacks trickle through the dirty mask while voices sound.
+    void loadPreset(const std::vector<std::pair<juce::String, float>>& normalizedValues);
+
+    // Preloads MIDI programs for audio-path program changes: each entry is
+    // decoded into a ready-to-apply SubParamBlock here (message thread), so
+    // processBlock() can switch patches at the event's sample position with
+    // zero allocation and no main-thread round trip.
+    void setProgramBank(
+        const std::vector<std::vector<std::pair<juce::String, float>>>& programs);
 
 private:
+    // Declared before synthHandle so the shared tables exist by the time
+    // sub_synth_create runs; the first instance builds them, the rest share
+    juce::SharedResourcePointer<SharedEngineTables> sharedTables;
+
     SubSynthHandle synthHandle = nullptr;
     juce::AudioProcessorValueTreeState parameters;
 
@@ -52,6 +80,9 @@ private:
     static constexpr const char* PWM_RATE = "pwm_rate";
     static constexpr const char* FM_AMOUNT = "fm_amount";
     static constexpr const char* FM_RATIO = "fm_ratio";
+    static constexpr const char* UNISON_VOICES = "unison_voices";
+    static constexpr const char* UNISON_DETUNE = "unison_detune";
+    static constexpr const char* UNISON_SPREAD = "unison_spread";
     static constexpr const char* FILTER_CUTOFF = "filter_cutoff";
     static constexpr const char* FILTER_RESO = "filter_reso";
     static constexpr const char* FILTER_SLOPE = "filter_slope";
@@ -66,9 +97,108 @@ private:
     static constexpr const char* FLT_S = "flt_s";
     static constexpr const char* FLT_R = "flt_r";
     static constexpr const char* MASTER_VOL = "master_vol";
+    static constexpr const char* POLYPHONY = "polyphony";
+    static constexpr const char* STEAL_MODE = "steal_mode";
+    static constexpr const char* BUDGET = "cpu_budget";
+
+    // Binary state blob: "O19S" magic, version, then the normalized
+    // parameter values packed in layout order (little-endian throughout)
+    static constexpr int kStateMagic = 0x4F313953;  // "O19S"
+    static constexpr int kStateVersion = 1;
+
+    // Bit positions in the dirty-parameter mask (one bit per engine parameter).
+    // APVTS listeners set bits from the host/UI threads; processBlock() drains
+    // the mask at block start so only changed values cross the FFI boundary.
+    enum ParamBit : int
+    {
+        kBitOsc1Wave = 0,
+        kBitOsc1Level,
+        kBitOsc2Wave,
+        kBitOsc2Level,
+        kBitOsc2Detune,
+        kBitSubWave,
+        kBitSubLevel,
+        kBitSubOctave,
+        kBitNoiseLevel,
+        kBitPulseWidth,
+        kBitPwmDepth,
+        kBitPwmRate,
+        kBitFmAmount,
+        kBitFmRatio,
+        kBitFilterCutoff,
+        kBitFilterReso,
+        kBitFilterSlope,
+        kBitFilterEnv,
+        kBitHpfCutoff,
+        kBitAmpA, kBitAmpD, kBitAmpS, kBitAmpR,
+        kBitFltA, kBitFltD, kBitFltS, kBitFltR,
+        kBitMasterVol,
+        kBitPolyphony,
+        kBitStealMode,
+        kBitUnisonVoices = 30,  // matches SubParamBlock bits 30-32
+        kBitUnisonDetune,
+        kBitUnisonSpread,
+    };
+    static constexpr uint64_t bit(int b) { return 1ull << b; }
+    static constexpr uint64_t kAmpAdsrBits =
+        bit(kBitAmpA) | bit(kBitAmpD) | bit(kBitAmpS) | bit(kBitAmpR);
+    static constexpr uint64_t kFltAdsrBits =
+        bit(kBitFltA) | bit(kBitFltD) | bit(kBitFltS) | bit(kBitFltR);
+
+    std::atomic<uint64_t> dirtyParams { 0 };
+    std::atomic<bool> fullPushPending { true };
+    std::atomic<bool> presetPending { false };
+    std::map<juce::String, int> paramBitById;
+
+    // Scratch buffer for sample-accurate event scheduling (reserved up
+    // front so processBlock() normally does not allocate)
+    std::vector<MidiEvent> midiEvents;
+
+    // Per-block render stats for the editor's CPU/voice meter
+    TelemetryRing telemetry;
+
+    // Block size from the last prepareToPlay(); threading decisions depend on it
+    int preparedBlockSize = 0;
+
+    // Process-wide arbiter splitting the core budget across all plugin
+    // instances that use the engine worker pool. The generation stamp lets
+    // processBlock() notice a re-split with one atomic load.
+    juce::SharedResourcePointer<RenderCoordinator> renderCoordinator;
+    bool registeredPoolClient = false;
+    juce::uint32 appliedThreadGeneration = 0;
+
+    // CPU budgeter state: one-pole smoothed load (render time / deadline)
+    // and whether we are currently degrading quality. Audio thread only.
+    float smoothedLoad = 0.0f;
+    bool budgetPressure = false;
+
+    // MIDI program bank: decoded parameter blocks ready for the audio
+    // thread. The block is applied via sub_synth_apply_preset; the
+    // normalized values are kept so the APVTS can be synced afterwards on
+    // the message thread (AsyncUpdater), keeping host/UI state coherent.
+    struct ProgramSlot
+    {
+        bool valid = false;
+        SubParamBlock block {};
+        std::vector<std::pair<juce::String, float>> normalized;
+    };
+    static constexpr int kNumPrograms = 128;
+    static constexpr int kMaxProgramChangesPerBlock = 8;
+    std::array<ProgramSlot, kNumPrograms> programBank;
+    juce::SpinLock programLock;
+    std::atomic<int> lastProgramApplied { -1 };
+
+    void registerParamBit(const juce::String& paramID, int bitIndex);
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void updateRenderThreading();
+    void applyThreadBudget();
+    void handleAsyncUpdate() override;
 
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
-    void applyParameters();
+    void applyParameters(uint64_t dirtyBits, bool asPreset = false);
+    void buildProgramBlock(const std::vector<std::pair<juce::String, float>>& normalizedValues,
+                           SubParamBlock& block) const;
+    void applyProgramChange(int programIndex);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Ossian19SubProcessor)
 };